@@ -0,0 +1,66 @@
+#include "../Other/BenchmarkPrefix.h"
+
+#include <algorithm>
+
+using reax::detail::any;
+
+namespace {
+// Small enough to be stored inline
+struct SmallStruct
+{
+    float x;
+    float y;
+
+    bool operator==(const SmallStruct& other) const { return (x == other.x && y == other.y); }
+};
+
+// Too large to be stored inline, so it's allocated on the heap
+struct LargeStruct
+{
+    double values[16];
+
+    bool operator==(const LargeStruct& other) const { return std::equal(std::begin(values), std::end(values), std::begin(other.values)); }
+};
+
+const int64 numOperations = 1000000;
+
+template<typename T>
+void measureConstructAndGet(BenchmarkContext& context, const String& typeName, const T& value)
+{
+    context.measure("construct " + typeName, numOperations, [&]() {
+        for (int64 i = 0; i < numOperations; ++i) {
+            any a(value);
+            keepValue(a);
+        }
+    });
+
+    const any a(value);
+    context.measure("get " + typeName, numOperations, [&]() {
+        for (int64 i = 0; i < numOperations; ++i) {
+            keepValue(a);
+            keepValue(a.get<T>());
+        }
+    });
+
+    context.measure("copy " + typeName, numOperations, [&]() {
+        for (int64 i = 0; i < numOperations; ++i) {
+            any copy(a);
+            keepValue(copy);
+        }
+    });
+}
+}
+
+void runAnyBenchmarks(BenchmarkContext& context)
+{
+    measureConstructAndGet(context, "int", 42);
+    measureConstructAndGet(context, "float", 0.5f);
+    measureConstructAndGet(context, "double", 0.25);
+    measureConstructAndGet(context, "String", String("Hello World"));
+    measureConstructAndGet(context, "var", var(3.5));
+    measureConstructAndGet(context, "inline struct", SmallStruct{ 1.f, 2.f });
+
+    LargeStruct largeStruct;
+    std::fill(std::begin(largeStruct.values), std::end(largeStruct.values), 1.0);
+    measureConstructAndGet(context, "heap struct", largeStruct);
+}
@@ -0,0 +1,76 @@
+#include "../Other/BenchmarkPrefix.h"
+
+namespace {
+String getName(ProducerPolicy producerPolicy)
+{
+    return (producerPolicy == ProducerPolicy::SingleProducer ? "SingleProducer" : "MultipleProducers");
+}
+
+// The cost of calling onNext on the audio thread. The values are emitted on the message thread between the samples.
+void measureOnNext(BenchmarkContext& context, ProducerPolicy producerPolicy)
+{
+    const String name = "onNext (" + getName(producerPolicy) + ")";
+    if (!context.shouldRun(name))
+        return;
+
+    // The queue is large enough that no values are dropped
+    const int64 numValues = 1024;
+    LockFreeSource<float> source(static_cast<size_t>(numValues * 2), producerPolicy);
+    int64 numReceived = 0;
+    int64 numSent = 0;
+
+    DisposeBag disposeBag;
+    source.subscribe([&](float) { ++numReceived; }).disposedBy(disposeBag);
+
+    context.measure(name, numValues, [&]() {
+        for (int64 i = 0; i < numValues; ++i)
+            source.onNext(static_cast<float>(i), CongestionPolicy::DropOldest);
+    }, [&]() {
+        numSent += numValues;
+        runDispatchLoopUntil([&]() { return numReceived == numSent; });
+    });
+}
+
+// The time from calling onNext on a realtime thread to receiving the value on the message thread
+void measureLatency(BenchmarkContext& context, ProducerPolicy producerPolicy)
+{
+    const String name = "latency from onNext to the message thread (" + getName(producerPolicy) + ")";
+    if (!context.shouldRun(name))
+        return;
+
+    const int numValues = context.getNumSamples() * 10;
+    std::vector<double> latencies;
+    latencies.reserve(static_cast<size_t>(numValues));
+    std::atomic<int> numReceived{ 0 };
+
+    LockFreeSource<double> source(16, producerPolicy);
+    DisposeBag disposeBag;
+    source.subscribe([&](double sendTime) {
+        latencies.push_back(nowInNanoseconds() - sendTime);
+        numReceived.store(numReceived.load() + 1);
+    }).disposedBy(disposeBag);
+
+    // Sends one value at a time, so each value is measured without a queue of pending values
+    std::thread realtimeThread([&]() {
+        for (int i = 0; i < numValues; ++i) {
+            source.onNext(nowInNanoseconds(), CongestionPolicy::DropOldest);
+
+            while (numReceived.load() <= i)
+                std::this_thread::yield();
+        }
+    });
+
+    runDispatchLoopUntil([&]() { return numReceived.load() == numValues; }, 60000);
+    realtimeThread.join();
+
+    context.addLatencies(name, std::move(latencies));
+}
+}
+
+void runLockFreeSourceBenchmarks(BenchmarkContext& context)
+{
+    for (auto producerPolicy : { ProducerPolicy::MultipleProducers, ProducerPolicy::SingleProducer }) {
+        measureOnNext(context, producerPolicy);
+        measureLatency(context, producerPolicy);
+    }
+}
@@ -0,0 +1,93 @@
+#include "../Other/BenchmarkPrefix.h"
+
+namespace {
+const int64 numValues = 1024;
+
+// The cost of dequeueing on the audio thread. The queue is filled again between the samples.
+void measureDequeue(BenchmarkContext& context, const String& name, LockFreeTarget<float>& target)
+{
+    if (!context.shouldRun(name))
+        return;
+
+    const auto fill = [&]() {
+        for (int64 i = 0; i < numValues; ++i)
+            target.onNext(static_cast<float>(i));
+    };
+
+    float sum = 0;
+    fill();
+
+    context.measure(name, numValues, [&]() {
+        float value = 0;
+        while (target.tryDequeue(value))
+            sum += value;
+    }, fill);
+
+    keepValue(sum);
+}
+
+// The cost of reading the latest value on the audio thread, optionally while another thread keeps pushing new values (like a busy GUI)
+void measureLatestValue(BenchmarkContext& context, bool withWriter)
+{
+    const String name = String("LatestValueTarget::getLatestValue") + (withWriter ? " (while another thread calls onNext)" : "");
+    if (!context.shouldRun(name))
+        return;
+
+    LatestValueTarget<float> target(0.f);
+    std::atomic<bool> isRunning{ withWriter };
+    std::thread writer([&]() {
+        for (int i = 0; isRunning.load(std::memory_order_relaxed); ++i)
+            target.onNext(static_cast<float>(i));
+    });
+
+    float sum = 0;
+    context.measure(name, numValues, [&]() {
+        for (int64 i = 0; i < numValues; ++i)
+            sum += target.getLatestValue();
+    });
+
+    isRunning.store(false);
+    writer.join();
+    keepValue(sum);
+}
+
+// The cost of producing a block of smoothed values, with a new target value for each block
+void measureSmoothedValue(BenchmarkContext& context)
+{
+    const String name = "SmoothedValueTarget::fillRamp (512 samples)";
+    if (!context.shouldRun(name))
+        return;
+
+    const int blockSize = 512;
+    SmoothedValueTarget<float> target(0.f);
+    target.reset(48000, 0.05);
+
+    std::vector<float> block(static_cast<size_t>(blockSize));
+    int numBlocks = 0;
+
+    context.measure(name, blockSize, [&]() {
+        target.fillRamp(block.data(), blockSize);
+    }, [&]() {
+        target.onNext(static_cast<float>(++numBlocks % 2));
+    });
+
+    keepValue(block);
+}
+}
+
+void runLockFreeTargetBenchmarks(BenchmarkContext& context)
+{
+    {
+        LockFreeTarget<float> target;
+        measureDequeue(context, "LockFreeTarget::tryDequeue (unbounded)", target);
+    }
+
+    {
+        LockFreeTarget<float> target(static_cast<size_t>(numValues), CongestionPolicy::DropOldest);
+        measureDequeue(context, "LockFreeTarget::tryDequeue (bounded)", target);
+    }
+
+    measureLatestValue(context, false);
+    measureLatestValue(context, true);
+    measureSmoothedValue(context);
+}
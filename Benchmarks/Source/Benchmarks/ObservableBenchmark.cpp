@@ -0,0 +1,124 @@
+#include "../Other/BenchmarkPrefix.h"
+
+namespace {
+void measureOperatorChains(BenchmarkContext& context)
+{
+    // The same 5 operators, with and without type erasure
+    const int numValues = 10000000;
+    const auto source = Observable<int>::range(1, numValues);
+    int64 sum = 0;
+
+    const Observable<int> untyped = source
+        .map([](int i) { return i + 1; })
+        .filter([](const int& i) { return (i % 3 != 0); })
+        .map([](int i) { return i * 2; })
+        .filter([](const int& i) { return (i % 5 != 0); })
+        .map([](int i) { return i - 1; });
+
+    context.measure("map/filter chain (5 operators, 10M ints)", numValues, [&]() {
+        untyped.subscribe([&](int i) { sum += i; });
+    });
+
+    const Observable<int> typed = source.typed()
+        .map([](int i) { return i + 1; })
+        .filter([](int i) { return (i % 3 != 0); })
+        .map([](int i) { return i * 2; })
+        .filter([](int i) { return (i % 5 != 0); })
+        .map([](int i) { return i - 1; });
+
+    context.measure("typed map/filter chain (5 operators, 10M ints)", numValues, [&]() {
+        typed.subscribe([&](int i) { sum += i; });
+    });
+
+    keepValue(sum);
+}
+
+void measureCombineLatest(BenchmarkContext& context)
+{
+    const int64 numValues = 1000000;
+    PublishSubject<int> first;
+    PublishSubject<int> second;
+    int64 sum = 0;
+
+    DisposeBag disposeBag;
+    first.combineLatest([](int a, int b) { return a + b; }, second)
+        .map([](int i) { return i * 2; })
+        .filter([](const int& i) { return (i % 3 != 0); })
+        .subscribe([&](int i) { sum += i; })
+        .disposedBy(disposeBag);
+
+    first.onNext(0);
+    second.onNext(0);
+
+    context.measure("combineLatest/map/filter chain", numValues, [&]() {
+        for (int i = 0; i < numValues / 2; ++i) {
+            first.onNext(i);
+            second.onNext(i);
+        }
+    });
+
+    keepValue(sum);
+}
+
+// The N-ary operators, with N input Observables
+void measureNAryOperators(BenchmarkContext& context, int n)
+{
+    const int64 numValues = 100000;
+    const String suffix = " (N = " + String(n) + ")";
+
+    std::vector<PublishSubject<int>> subjects(static_cast<size_t>(n));
+    Array<Observable<int>> observables;
+    for (auto& subject : subjects)
+        observables.add(subject);
+
+    int64 sum = 0;
+
+    // Emits numValues values, spread evenly over the subjects
+    const auto emitValues = [&]() {
+        for (int64 i = 0; i < numValues; ++i)
+            subjects[static_cast<size_t>(i % n)].onNext(static_cast<int>(i));
+    };
+
+    if (context.shouldRun("combineLatest" + suffix)) {
+        DisposeBag disposeBag;
+        Observable<int>::combineLatest(observables, [](const Array<int>& values) { return values.getUnchecked(0); })
+            .subscribe([&](int i) { sum += i; })
+            .disposedBy(disposeBag);
+
+        // combineLatest only emits after each input has emitted
+        for (auto& subject : subjects)
+            subject.onNext(0);
+
+        context.measure("combineLatest" + suffix, numValues, emitValues);
+    }
+
+    if (context.shouldRun("merge" + suffix)) {
+        DisposeBag disposeBag;
+        Observable<int>::merge(observables)
+            .subscribe([&](int i) { sum += i; })
+            .disposedBy(disposeBag);
+
+        context.measure("merge" + suffix, numValues, emitValues);
+    }
+
+    if (context.shouldRun("zip" + suffix)) {
+        DisposeBag disposeBag;
+        Observable<int>::zip(observables, [](const Array<int>& values) { return values.getUnchecked(0); })
+            .subscribe([&](int i) { sum += i; })
+            .disposedBy(disposeBag);
+
+        context.measure("zip" + suffix, numValues, emitValues);
+    }
+
+    keepValue(sum);
+}
+}
+
+void runObservableBenchmarks(BenchmarkContext& context)
+{
+    measureOperatorChains(context);
+    measureCombineLatest(context);
+
+    for (int n : { 8, 64, 512 })
+        measureNAryOperators(context, n);
+}
@@ -0,0 +1,36 @@
+#include "../Other/BenchmarkPrefix.h"
+
+namespace {
+// The cost of constructing a Reactive<ComponentType> (including its extension). The components are destroyed between the samples.
+template<typename ComponentType>
+void measureConstruction(BenchmarkContext& context, const String& name)
+{
+    const int numComponents = 1000;
+    std::vector<std::unique_ptr<Reactive<ComponentType>>> components;
+    components.reserve(static_cast<size_t>(numComponents));
+
+    context.measure("construct 1000 " + name, numComponents, [&]() {
+        for (int i = 0; i < numComponents; ++i)
+            components.emplace_back(new Reactive<ComponentType>());
+    }, [&]() {
+        components.clear();
+    });
+
+    context.measure("destroy 1000 " + name, numComponents, [&]() {
+        components.clear();
+    }, [&]() {
+        for (int i = 0; i < numComponents; ++i)
+            components.emplace_back(new Reactive<ComponentType>());
+    });
+
+    components.clear();
+}
+}
+
+void runReactiveGUIBenchmarks(BenchmarkContext& context)
+{
+    measureConstruction<Component>(context, "Reactive<Component>");
+    measureConstruction<Label>(context, "Reactive<Label>");
+    measureConstruction<Slider>(context, "Reactive<Slider>");
+    measureConstruction<TextButton>(context, "Reactive<TextButton>");
+}
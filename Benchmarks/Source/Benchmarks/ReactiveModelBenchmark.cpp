@@ -0,0 +1,152 @@
+#include "../Other/BenchmarkPrefix.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+class DummyAudioProcessor : public Reactive<AudioProcessor>
+{
+public:
+    // Dummy overrides
+    const String getName() const override { return "DummyAudioProcessor"; }
+    void prepareToPlay(double, int) override {}
+    void releaseResources() override {}
+    void processBlock(AudioBuffer<float>&, MidiBuffer&) override {}
+    double getTailLengthSeconds() const override { return 0; }
+    bool acceptsMidi() const override { return false; }
+    bool producesMidi() const override { return false; }
+    AudioProcessorEditor* createEditor() override { return nullptr; }
+    bool hasEditor() const override { return false; }
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram(int) override {}
+    const String getProgramName(int) override { return ""; }
+    void changeProgramName(int, const String&) override {}
+    void getStateInformation(juce::MemoryBlock&) override {}
+    void setStateInformation(const void*, int) override {}
+};
+
+// How the automated parameters are observed on the message thread
+enum class Observation {
+    None,
+    ParameterValue,
+    RawParameterValues
+};
+
+const int numParameters = 256;
+
+// A plugin whose parameters are all automated by the host
+struct AutomatedPlugin
+{
+    DummyAudioProcessor processor;
+    Reactive<AudioProcessorValueTreeState> valueTreeState;
+    std::vector<AudioProcessorParameter*> parameters;
+    std::vector<AudioProcessorValueTreeStateExtension::ParameterHandle> handles;
+
+    AutomatedPlugin()
+    : valueTreeState(processor, nullptr)
+    {
+        const NormalisableRange<float> range(0, 1);
+        for (int i = 0; i < numParameters; ++i) {
+            const String parameterID = "parameter" + String(i);
+            valueTreeState.createAndAddParameter(parameterID, parameterID, "", range, 0.5f, nullptr, nullptr);
+        }
+
+        valueTreeState.state = ValueTree("Benchmark");
+
+        for (int i = 0; i < numParameters; ++i) {
+            const String parameterID = "parameter" + String(i);
+            parameters.push_back(valueTreeState.getParameter(parameterID));
+            handles.push_back(valueTreeState.rx.parameterHandle(parameterID));
+        }
+    }
+
+    // Sets all parameters, like the host does in one audio block
+    void automate(float value)
+    {
+        for (auto parameter : parameters)
+            parameter->setValue(value);
+    }
+};
+
+String getName(Observation observation)
+{
+    switch (observation) {
+        case Observation::None:
+            return "not observed";
+        case Observation::ParameterValue:
+            return "observed with parameterValue";
+        case Observation::RawParameterValues:
+            return "observed with rawParameterValues";
+    }
+
+    return {};
+}
+
+/*
+ Measures the cost of automating 256 parameters on the audio thread, and the time until the new values have arrived on the message thread.
+
+ The parameters alternate between two values in each block, so each parameter changes in each block.
+ */
+void measureAutomation(BenchmarkContext& context, Observation observation)
+{
+    const String name = "automate " + String(numParameters) + " parameters (" + getName(observation) + ")";
+    if (!context.shouldRun(name))
+        return;
+
+    AutomatedPlugin plugin;
+    DisposeBag disposeBag;
+
+    // The latest value of each parameter, as observed on the message thread
+    std::vector<float> latestValues(static_cast<size_t>(numParameters), -1.f);
+
+    for (size_t i = 0; i < plugin.handles.size(); ++i) {
+        if (observation == Observation::ParameterValue) {
+            plugin.valueTreeState.rx.parameterValue(plugin.handles[i]).subscribe([&latestValues, i](const var& value) {
+                if (!value.isVoid())
+                    latestValues[i] = value;
+            }).disposedBy(disposeBag);
+        }
+        else if (observation == Observation::RawParameterValues) {
+            plugin.valueTreeState.rx.rawParameterValues(plugin.handles[i]).subscribe([&latestValues, i](float value) {
+                latestValues[i] = value;
+            }).disposedBy(disposeBag);
+        }
+    }
+
+    float value = 0.5f;
+    const auto hasReceived = [&]() {
+        return std::all_of(latestValues.begin(), latestValues.end(), [&](float latestValue) { return (std::abs(latestValue - value) < 1e-4f); });
+    };
+
+    // JUCE updates the value tree state asynchronously. Wait for the first update:
+    if (observation != Observation::None)
+        runDispatchLoopUntil(hasReceived);
+
+    std::vector<double> latencies;
+
+    context.measure(name, numParameters, [&]() {
+        value = (value == 0.25f ? 0.75f : 0.25f);
+        plugin.automate(value);
+    }, [&]() {
+        if (observation == Observation::None)
+            return;
+
+        const double startTime = nowInNanoseconds();
+        runDispatchLoopUntil(hasReceived);
+        latencies.push_back(nowInNanoseconds() - startTime);
+    });
+
+    if (observation != Observation::None) {
+        // Skip the warm-up sample
+        latencies.erase(latencies.begin());
+        context.addLatencies(name + ", latency until observed", std::move(latencies));
+    }
+}
+}
+
+void runReactiveModelBenchmarks(BenchmarkContext& context)
+{
+    for (auto observation : { Observation::None, Observation::ParameterValue, Observation::RawParameterValues })
+        measureAutomation(context, observation);
+}
@@ -0,0 +1,73 @@
+#include "../Other/BenchmarkPrefix.h"
+
+namespace {
+// Measures the time from calling onNext on a std::thread to receiving the value on the message thread
+void measureHopToMessageThread(BenchmarkContext& context)
+{
+    const String name = "hop from a background thread to the message thread";
+    if (!context.shouldRun(name))
+        return;
+
+    const int numHops = context.getNumSamples() * 10;
+    std::vector<double> latencies;
+    latencies.reserve(static_cast<size_t>(numHops));
+    std::atomic<int> numReceived{ 0 };
+
+    PublishSubject<double> subject;
+    DisposeBag disposeBag;
+    subject.observeOn(Scheduler::messageThread()).subscribe([&](double sendTime) {
+        latencies.push_back(nowInNanoseconds() - sendTime);
+        numReceived.store(numReceived.load() + 1);
+    }).disposedBy(disposeBag);
+
+    // Sends one value at a time, so each hop is measured without a queue of pending values
+    std::thread sender([&]() {
+        for (int i = 0; i < numHops; ++i) {
+            subject.onNext(nowInNanoseconds());
+
+            while (numReceived.load() <= i)
+                std::this_thread::yield();
+        }
+    });
+
+    runDispatchLoopUntil([&]() { return numReceived.load() == numHops; }, 60000);
+    sender.join();
+
+    context.addLatencies(name, std::move(latencies));
+}
+
+// Measures the time from calling onNext on the message thread to receiving the value on a thread of the given Scheduler
+void measureHopFromMessageThread(BenchmarkContext& context, const String& name, const Scheduler& scheduler)
+{
+    if (!context.shouldRun(name))
+        return;
+
+    const int numHops = context.getNumSamples() * 10;
+    std::vector<double> latencies;
+    latencies.reserve(static_cast<size_t>(numHops));
+    std::atomic<int> numReceived{ 0 };
+
+    PublishSubject<double> subject;
+    DisposeBag disposeBag;
+    subject.observeOn(scheduler).subscribe([&](double sendTime) {
+        latencies.push_back(nowInNanoseconds() - sendTime);
+        numReceived.store(numReceived.load() + 1);
+    }).disposedBy(disposeBag);
+
+    for (int i = 0; i < numHops; ++i) {
+        subject.onNext(nowInNanoseconds());
+
+        while (numReceived.load() <= i)
+            std::this_thread::yield();
+    }
+
+    context.addLatencies(name, std::move(latencies));
+}
+}
+
+void runSchedulerBenchmarks(BenchmarkContext& context)
+{
+    measureHopToMessageThread(context);
+    measureHopFromMessageThread(context, "hop from the message thread to the background thread", Scheduler::backgroundThread());
+    measureHopFromMessageThread(context, "hop from the message thread to a thread pool", Scheduler::threadPool(4));
+}
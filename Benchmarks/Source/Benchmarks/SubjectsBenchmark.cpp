@@ -0,0 +1,127 @@
+#include "../Other/BenchmarkPrefix.h"
+
+namespace {
+const int64 numValues = 100000;
+
+void measureFanOut(BenchmarkContext& context, int numSubscribers)
+{
+    const String suffix = " (" + String(numSubscribers) + (numSubscribers == 1 ? " subscriber)" : " subscribers)");
+    std::atomic<int64> sum{ 0 };
+
+    {
+        PublishSubject<int> subject;
+        DisposeBag disposeBag;
+        for (int i = 0; i < numSubscribers; ++i)
+            subject.subscribe([&](int value) { sum.fetch_add(value, std::memory_order_relaxed); }).disposedBy(disposeBag);
+
+        context.measure("PublishSubject::onNext" + suffix, numValues, [&]() {
+            for (int64 i = 0; i < numValues; ++i)
+                subject.onNext(static_cast<int>(i));
+        });
+    }
+
+    {
+        BehaviorSubject<int> subject(0);
+        DisposeBag disposeBag;
+        for (int i = 0; i < numSubscribers; ++i)
+            subject.subscribe([&](int value) { sum.fetch_add(value, std::memory_order_relaxed); }).disposedBy(disposeBag);
+
+        context.measure("BehaviorSubject::onNext" + suffix, numValues, [&]() {
+            for (int64 i = 0; i < numValues; ++i)
+                subject.onNext(static_cast<int>(i));
+        });
+    }
+
+    {
+        ReplaySubject<int> subject(64);
+        DisposeBag disposeBag;
+        for (int i = 0; i < numSubscribers; ++i)
+            subject.subscribe([&](int value) { sum.fetch_add(value, std::memory_order_relaxed); }).disposedBy(disposeBag);
+
+        context.measure("ReplaySubject::onNext (buffer size 64)" + suffix, numValues, [&]() {
+            for (int64 i = 0; i < numValues; ++i)
+                subject.onNext(static_cast<int>(i));
+        });
+    }
+
+    keepValue(sum);
+}
+
+// Several threads call onNext at the same time, while another thread keeps subscribing and unsubscribing
+void measureContention(BenchmarkContext& context, int numThreads)
+{
+    const String name = "PublishSubject::onNext contention (" + String(numThreads) + " threads, 10 subscribers)";
+    if (!context.shouldRun(name))
+        return;
+
+    PublishSubject<int> subject;
+    std::atomic<int64> sum{ 0 };
+    DisposeBag disposeBag;
+    for (int i = 0; i < 10; ++i)
+        subject.subscribe([&](int value) { sum.fetch_add(value, std::memory_order_relaxed); }).disposedBy(disposeBag);
+
+    std::atomic<bool> isRunning{ true };
+    std::thread subscriber([&]() {
+        while (isRunning.load()) {
+            auto subscription = subject.subscribe([](int) {});
+            subscription.unsubscribe();
+        }
+    });
+
+    const int64 numValuesPerThread = numValues / numThreads;
+    context.measure(name, numValuesPerThread * numThreads, [&]() {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([&]() {
+                for (int64 i = 0; i < numValuesPerThread; ++i)
+                    subject.onNext(static_cast<int>(i));
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+    });
+
+    isRunning.store(false);
+    subscriber.join();
+    keepValue(sum);
+}
+
+void measureGetValue(BenchmarkContext& context)
+{
+    BehaviorSubject<int> subject(17);
+    int64 sum = 0;
+
+    context.measure("BehaviorSubject::getValue", numValues, [&]() {
+        for (int64 i = 0; i < numValues; ++i)
+            sum += subject.getValue();
+    });
+
+    // Another thread keeps pushing new values
+    std::atomic<bool> isRunning{ true };
+    std::thread writer([&]() {
+        for (int i = 0; isRunning.load(); ++i)
+            subject.onNext(i);
+    });
+
+    context.measure("BehaviorSubject::getValue (while another thread calls onNext)", numValues, [&]() {
+        for (int64 i = 0; i < numValues; ++i)
+            sum += subject.getValue();
+    });
+
+    isRunning.store(false);
+    writer.join();
+    keepValue(sum);
+}
+}
+
+void runSubjectsBenchmarks(BenchmarkContext& context)
+{
+    for (int numSubscribers : { 1, 10, 100 })
+        measureFanOut(context, numSubscribers);
+
+    for (int numThreads : { 2, 4, 8 })
+        measureContention(context, numThreads);
+
+    measureGetValue(context);
+}
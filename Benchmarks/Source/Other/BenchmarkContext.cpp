@@ -0,0 +1,102 @@
+#include "BenchmarkPrefix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+// Returns the given percentile (in the range [0..1]) of the sorted samples
+double percentile(const std::vector<double>& sortedSamples, double p)
+{
+    jassert(!sortedSamples.empty());
+
+    const auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sortedSamples.size())));
+    return sortedSamples[jlimit<size_t>(1, sortedSamples.size(), rank) - 1];
+}
+}
+
+BenchmarkContext::BenchmarkContext(const String& filter, int numSamples)
+: filter(filter),
+  numSamples(numSamples)
+{
+    // At least one sample is needed to calculate the statistics
+    jassert(numSamples > 0);
+}
+
+void BenchmarkContext::setGroup(const String& newGroup)
+{
+    group = newGroup;
+}
+
+bool BenchmarkContext::shouldRun(const String& name) const
+{
+    return (group + "/" + name).contains(filter);
+}
+
+int BenchmarkContext::getNumSamples() const
+{
+    return numSamples;
+}
+
+void BenchmarkContext::measure(const String& name, int64 operationsPerSample, const std::function<void()>& runSample, const std::function<void()>& afterSample)
+{
+    if (!shouldRun(name))
+        return;
+
+    std::vector<double> samples;
+    samples.reserve(static_cast<size_t>(numSamples));
+
+    // The first call warms up the caches (and any lazily allocated memory), and isn't timed
+    for (int i = -1; i < numSamples; ++i) {
+        const auto startTicks = Time::getHighResolutionTicks();
+        runSample();
+        const auto endTicks = Time::getHighResolutionTicks();
+
+        if (afterSample)
+            afterSample();
+
+        if (i >= 0)
+            samples.push_back(Time::highResolutionTicksToSeconds(endTicks - startTicks) * 1e9 / static_cast<double>(operationsPerSample));
+    }
+
+    addResult(name, "ns/op", operationsPerSample, std::move(samples));
+}
+
+void BenchmarkContext::addLatencies(const String& name, std::vector<double> nanoseconds)
+{
+    if (!shouldRun(name))
+        return;
+
+    // The benchmark must have recorded at least one latency
+    jassert(!nanoseconds.empty());
+    if (nanoseconds.empty())
+        return;
+
+    addResult(name, "ns", 1, std::move(nanoseconds));
+}
+
+const Array<BenchmarkResult>& BenchmarkContext::getResults() const
+{
+    return results;
+}
+
+void BenchmarkContext::addResult(const String& name, const String& unit, int64 operationsPerSample, std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+
+    BenchmarkResult result;
+    result.group = group;
+    result.name = name;
+    result.unit = unit;
+    result.operationsPerSample = operationsPerSample;
+    result.numSamples = static_cast<int>(samples.size());
+    result.min = samples.front();
+    result.median = percentile(samples, 0.5);
+    result.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+    result.p99 = percentile(samples, 0.99);
+    result.max = samples.back();
+
+    results.add(result);
+
+    std::cerr << (group + "/" + name).paddedRight(' ', 60) << " median " << String(result.median, 1) << " " << unit << std::endl;
+}
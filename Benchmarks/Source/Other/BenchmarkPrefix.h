@@ -0,0 +1,113 @@
+#pragma once
+
+#define DONT_SET_USING_JUCE_NAMESPACE 1
+#include "JuceHeader.h"
+
+#include <thread>
+
+REAX_ENABLE_EXTRA_WARNINGS
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wheader-hygiene"
+using namespace juce;
+using namespace reax;
+#pragma clang diagnostic pop
+
+
+/// The statistics of one measurement. All times are in nanoseconds.
+struct BenchmarkResult
+{
+    String group;
+    String name;
+
+    /// "ns/op" for throughput measurements (time per operation), or "ns" for latency measurements (time per sample).
+    String unit;
+    int64 operationsPerSample;
+    int numSamples;
+
+    double min;
+    double median;
+    double mean;
+    double p99;
+    double max;
+};
+
+/**
+ Runs the measurements of the benchmark functions and collects their results.
+ */
+class BenchmarkContext
+{
+public:
+    /// Creates a new instance. Only measurements whose "group/name" contains the filter are run. An empty filter matches all measurements.
+    BenchmarkContext(const String& filter, int numSamples);
+
+    /// Sets the group of the following measurements (e.g. "any" or "LockFreeSource").
+    void setGroup(const String& group);
+
+    /// Returns true if the measurement with the given name matches the filter. Check this before running expensive setup code.
+    bool shouldRun(const String& name) const;
+
+    /// The number of timed samples per measurement.
+    int getNumSamples() const;
+
+    /**
+     Measures throughput. Calls `runSample` once to warm up, and then getNumSamples() times while timing it. Each call must perform `operationsPerSample` operations. The result is the time per operation.
+
+     `afterSample` is called after each call to `runSample`, without timing it (e.g. to drain a queue).
+     */
+    void measure(const String& name, int64 operationsPerSample, const std::function<void()>& runSample, const std::function<void()>& afterSample = nullptr);
+
+    /// Adds a latency measurement from samples that the benchmark has timed itself (in nanoseconds).
+    void addLatencies(const String& name, std::vector<double> nanoseconds);
+
+    /// The results of all measurements so far.
+    const Array<BenchmarkResult>& getResults() const;
+
+private:
+    const String filter;
+    const int numSamples;
+    String group;
+    Array<BenchmarkResult> results;
+
+    void addResult(const String& name, const String& unit, int64 operationsPerSample, std::vector<double> samples);
+};
+
+/// Prevents the compiler from optimizing away the computation of a value.
+template<typename T>
+inline void keepValue(const T& value)
+{
+#if JUCE_MSVC
+    const volatile char* const address = reinterpret_cast<const volatile char*>(&value);
+    ignoreUnused(*address);
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+/// Returns the current time in nanoseconds, for measuring latencies across threads.
+inline double nowInNanoseconds()
+{
+    return Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks()) * 1e9;
+}
+
+/// Runs the JUCE dispatch loop until a given condition is fulfilled, or the timeout has elapsed. Returns whether the condition is fulfilled.
+template<typename Condition>
+bool runDispatchLoopUntil(Condition condition, int timeoutMilliseconds = 5000)
+{
+    const auto startTime = Time::getMillisecondCounter();
+    while (!condition() && Time::getMillisecondCounter() < startTime + static_cast<uint32>(timeoutMilliseconds))
+        MessageManager::getInstance()->runDispatchLoopUntil(1);
+
+    return condition();
+}
+
+// The benchmark functions. Each one is defined in its own file in Source/Benchmarks.
+void runAnyBenchmarks(BenchmarkContext& context);
+void runObservableBenchmarks(BenchmarkContext& context);
+void runSubjectsBenchmarks(BenchmarkContext& context);
+void runSchedulerBenchmarks(BenchmarkContext& context);
+void runLockFreeSourceBenchmarks(BenchmarkContext& context);
+void runLockFreeTargetBenchmarks(BenchmarkContext& context);
+void runReactiveGUIBenchmarks(BenchmarkContext& context);
+void runReactiveModelBenchmarks(BenchmarkContext& context);
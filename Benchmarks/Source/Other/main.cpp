@@ -0,0 +1,160 @@
+#include "BenchmarkPrefix.h"
+
+namespace {
+const char* const usage =
+    "Usage: ReaX-Benchmarks [--help] [--format=json|csv] [--output=<file>] [--samples=<n>] [--filter=<text>]\n"
+    "\n"
+    "  --format   The output format (default: json).\n"
+    "  --output   Writes the results to the given file, instead of stdout.\n"
+    "  --samples  The number of timed samples per measurement (default: 20).\n"
+    "  --filter   Only runs the measurements whose \"group/name\" contains the given text.\n";
+
+struct Options
+{
+    String format = "json";
+    String outputPath;
+    int numSamples = 20;
+    String filter;
+};
+
+// Returns false if the arguments are invalid
+bool parseArguments(const StringArray& arguments, Options& options)
+{
+    for (auto& argument : arguments) {
+        const String value = argument.fromFirstOccurrenceOf("=", false, false);
+
+        if (argument.startsWith("--format="))
+            options.format = value;
+        else if (argument.startsWith("--output="))
+            options.outputPath = value;
+        else if (argument.startsWith("--samples="))
+            options.numSamples = value.getIntValue();
+        else if (argument.startsWith("--filter="))
+            options.filter = value;
+        else
+            return false;
+    }
+
+    return ((options.format == "json" || options.format == "csv") && options.numSamples > 0);
+}
+
+var toJSON(const BenchmarkResult& result)
+{
+    DynamicObject::Ptr object(new DynamicObject());
+    object->setProperty("group", result.group);
+    object->setProperty("name", result.name);
+    object->setProperty("unit", result.unit);
+    object->setProperty("operationsPerSample", result.operationsPerSample);
+    object->setProperty("samples", result.numSamples);
+    object->setProperty("min", result.min);
+    object->setProperty("median", result.median);
+    object->setProperty("mean", result.mean);
+    object->setProperty("p99", result.p99);
+    object->setProperty("max", result.max);
+
+    return var(object.get());
+}
+
+String toJSON(const Array<BenchmarkResult>& results)
+{
+    DynamicObject::Ptr system(new DynamicObject());
+    system->setProperty("os", SystemStats::getOperatingSystemName());
+    system->setProperty("cpuVendor", SystemStats::getCpuVendor());
+    system->setProperty("cpuSpeedInMegahertz", SystemStats::getCpuSpeedInMegahertz());
+    system->setProperty("numCpus", SystemStats::getNumCpus());
+
+    Array<var> resultsArray;
+    for (auto& result : results)
+        resultsArray.add(toJSON(result));
+
+    DynamicObject::Ptr root(new DynamicObject());
+    root->setProperty("date", Time::getCurrentTime().toISO8601(true));
+    root->setProperty("juceVersion", SystemStats::getJUCEVersion());
+#if JUCE_DEBUG
+    root->setProperty("debugBuild", true);
+#else
+    root->setProperty("debugBuild", false);
+#endif
+    root->setProperty("system", var(system.get()));
+    root->setProperty("results", var(resultsArray));
+
+    return JSON::toString(var(root.get())) + "\n";
+}
+
+// Quotes a CSV field, so that it may contain commas and quotes
+String quoted(const String& field)
+{
+    return "\"" + field.replace("\"", "\"\"") + "\"";
+}
+
+String toCSV(const Array<BenchmarkResult>& results)
+{
+    String csv = "group,name,unit,operationsPerSample,samples,min,median,mean,p99,max\n";
+
+    for (auto& result : results) {
+        csv << quoted(result.group) << "," << quoted(result.name) << "," << result.unit << ","
+            << result.operationsPerSample << "," << result.numSamples << ","
+            << result.min << "," << result.median << "," << result.mean << "," << result.p99 << "," << result.max << "\n";
+    }
+
+    return csv;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    // The message thread is needed for LockFreeSource, the message thread Scheduler and the GUI extensions
+    ScopedJuceInitialiser_GUI juceInitialiser;
+
+    StringArray arguments;
+    for (int i = 1; i < argc; ++i)
+        arguments.add(argv[i]);
+
+    if (arguments.contains("--help")) {
+        std::cout << usage;
+        return 0;
+    }
+
+    Options options;
+    if (!parseArguments(arguments, options)) {
+        std::cerr << usage;
+        return 1;
+    }
+
+#if JUCE_DEBUG
+    std::cerr << "Warning: This is a debug build. Use a release build to get meaningful results." << std::endl;
+#endif
+
+    BenchmarkContext context(options.filter, options.numSamples);
+
+    const std::pair<const char*, void (*)(BenchmarkContext&)> groups[] = {
+        { "any", runAnyBenchmarks },
+        { "Observable", runObservableBenchmarks },
+        { "Subjects", runSubjectsBenchmarks },
+        { "Scheduler", runSchedulerBenchmarks },
+        { "LockFreeSource", runLockFreeSourceBenchmarks },
+        { "LockFreeTarget", runLockFreeTargetBenchmarks },
+        { "ReactiveGUI", runReactiveGUIBenchmarks },
+        { "ReactiveModel", runReactiveModelBenchmarks }
+    };
+
+    for (auto& group : groups) {
+        context.setGroup(group.first);
+        group.second(context);
+    }
+
+    const String output = (options.format == "json" ? toJSON(context.getResults()) : toCSV(context.getResults()));
+
+    if (options.outputPath.isEmpty()) {
+        std::cout << output;
+        return 0;
+    }
+
+    const File outputFile = File::getCurrentWorkingDirectory().getChildFile(options.outputPath);
+    if (!outputFile.replaceWithText(output)) {
+        std::cerr << "Could not write to " << outputFile.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
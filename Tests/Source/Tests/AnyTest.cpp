@@ -335,6 +335,152 @@ TEST_CASE("any",
         }
     }
     
+    CONTEXT("inline storage")
+    {
+        // Equality-comparable type that counts its living instances
+        struct Counted
+        {
+            Counted(int* numInstances, int value)
+            : numInstances(numInstances), value(value) { ++(*numInstances); }
+
+            Counted(const Counted& other)
+            : numInstances(other.numInstances), value(other.value) { ++(*numInstances); }
+
+            Counted(Counted&& other) noexcept
+            : numInstances(other.numInstances), value(other.value) { ++(*numInstances); }
+
+            ~Counted() { --(*numInstances); }
+
+            bool operator==(const Counted& other) const
+            {
+                return (value == other.value);
+            }
+
+            int* numInstances;
+            int value;
+        };
+
+        // Equality-comparable type that doesn't fit into the inline storage
+        struct Large
+        {
+            bool operator==(const Large& other) const
+            {
+                return (values[0] == other.values[0]);
+            }
+
+            double values[REAX_ANY_INLINE_STORAGE_SIZE];
+        };
+
+        IT("stores small, equality-comparable objects inline")
+        {
+            REQUIRE(any::is_stored_inline<String>::value);
+            REQUIRE(any::is_stored_inline<Point<int>>::value);
+            REQUIRE(any::is_stored_inline<Rectangle<int>>::value);
+            REQUIRE(any::is_stored_inline<var>::value);
+            REQUIRE(any::is_stored_inline<Counted>::value);
+        }
+
+        IT("stores large, move-only and non-comparable objects on the heap")
+        {
+            REQUIRE_FALSE(any::is_stored_inline<Large>::value);
+            REQUIRE_FALSE(any::is_stored_inline<std::unique_ptr<int>>::value);
+            REQUIRE_FALSE(any::is_stored_inline<CopyAndMoveConstructible>::value);
+        }
+
+        IT("destroys the inline value exactly once")
+        {
+            int numInstances = 0;
+
+            {
+                any original(Counted(&numInstances, 4));
+                any copy(original);
+                any moved(std::move(copy));
+                any assigned(17);
+                assigned = original;
+                moved = any(3);
+
+                CHECK(numInstances == 3);
+                REQUIRE(assigned.get<Counted>().value == 4);
+            }
+
+            REQUIRE(numInstances == 0);
+        }
+
+        IT("keeps the value when copying and assigning")
+        {
+            any point(Point<int>(9, -2));
+            any copy(point);
+            any assigned(String("Foo"));
+            assigned = point;
+
+            REQUIRE(copy.get<Point<int>>() == Point<int>(9, -2));
+            REQUIRE(assigned.get<Point<int>>() == Point<int>(9, -2));
+            REQUIRE(copy == point);
+            REQUIRE(assigned == point);
+        }
+
+        IT("can hold and compare objects that don't fit into the inline storage")
+        {
+            Large large;
+            large.values[0] = 12.5;
+            any anyLarge(large);
+
+            REQUIRE(anyLarge.is<Large>());
+            REQUIRE(anyLarge.get<Large>().values[0] == 12.5);
+            REQUIRE(anyLarge == any(large));
+        }
+
+        IT("is non-equal if one value is inline and the other is not an object")
+        {
+            REQUIRE(any(Point<int>(1, 2)) != any(1));
+            REQUIRE(any(1) != any(Point<int>(1, 2)));
+        }
+    }
+    
+    CONTEXT("types with identical layout")
+    {
+        struct First
+        {
+            bool operator==(const First& other) const { return (x == other.x); }
+            int x;
+        };
+
+        struct Second
+        {
+            bool operator==(const Second& other) const { return (x == other.x); }
+            int x;
+        };
+
+        struct FirstWithoutEquality
+        {
+            int x;
+        };
+
+        struct SecondWithoutEquality
+        {
+            int x;
+        };
+
+        IT("distinguishes inline objects of different types")
+        {
+            any first(First{ 3 });
+
+            REQUIRE(first.is<First>());
+            REQUIRE_FALSE(first.is<Second>());
+            REQUIRE_THROWS_WITH(first.get<Second>(), Contains("Error getting type from any."));
+            REQUIRE(first != any(Second{ 3 }));
+        }
+
+        IT("distinguishes heap objects of different types")
+        {
+            any first(FirstWithoutEquality{ 3 });
+
+            REQUIRE(first.is<FirstWithoutEquality>());
+            REQUIRE_FALSE(first.is<SecondWithoutEquality>());
+            REQUIRE_THROWS_WITH(first.get<SecondWithoutEquality>(), Contains("Error getting type from any."));
+        }
+    }
+    
     CONTEXT("move-only type")
     {
         IT("can hold a move-only (non-copyable) type")
@@ -0,0 +1,77 @@
+#include "../Other/TestPrefix.h"
+
+namespace {
+OperatorStatistics findStatistics(const String& name)
+{
+    for (auto& statistics : Instrumentation::getSnapshot()) {
+        if (statistics.name == name)
+            return statistics;
+    }
+
+    FAIL("No statistics for " << name);
+    return {};
+}
+}
+
+TEST_CASE("Instrumentation",
+          "[Instrumentation]")
+{
+    IT("is enabled if the module is compiled with REAX_ENABLE_INSTRUMENTATION")
+    {
+        REQUIRE(Instrumentation::isEnabled() == bool(REAX_ENABLE_INSTRUMENTATION));
+    }
+
+#if REAX_ENABLE_INSTRUMENTATION
+    PublishSubject<int> subject;
+    Instrumentation::resetCounters();
+
+    IT("counts the values of a named chain")
+    {
+        Array<int> values;
+        auto subscription = subject.named("InstrumentationTest")
+                                .map([](int i) { return i * 2; })
+                                .filter([](int i) { return i > 2; })
+                                .subscribe([&](int i) { values.add(i); });
+
+        subject.onNext(1);
+        subject.onNext(2);
+        subject.onNext(3);
+
+        ReaX_RequireValues(values, 4, 6);
+
+        const auto map = findStatistics("InstrumentationTest/map");
+        REQUIRE(map.numValuesIn == 3);
+        REQUIRE(map.numValuesOut == 3);
+        REQUIRE(map.numSubscribers == 1);
+
+        const auto filter = findStatistics("InstrumentationTest/filter");
+        REQUIRE(filter.numValuesIn == 3);
+        REQUIRE(filter.numValuesOut == 2);
+        REQUIRE(filter.numSubscribers == 1);
+
+        subscription.unsubscribe();
+        REQUIRE(findStatistics("InstrumentationTest/map").numSubscribers == 0);
+    }
+
+    IT("sets the value counters to zero when resetting")
+    {
+        auto subscription = subject.named("InstrumentationTest").skip(1).subscribe([](int) {});
+        subject.onNext(1);
+        subject.onNext(2);
+        REQUIRE(findStatistics("InstrumentationTest/skip").numValuesOut == 1);
+
+        Instrumentation::resetCounters();
+
+        const auto skip = findStatistics("InstrumentationTest/skip");
+        REQUIRE(skip.numValuesIn == 0);
+        REQUIRE(skip.numValuesOut == 0);
+        REQUIRE(skip.timeInCallbacks == RelativeTime());
+        REQUIRE(skip.numSubscribers == 1);
+    }
+#else
+    IT("returns an empty snapshot if instrumentation is disabled")
+    {
+        REQUIRE(Instrumentation::getSnapshot().isEmpty());
+    }
+#endif
+}
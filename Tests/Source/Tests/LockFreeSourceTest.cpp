@@ -1,5 +1,8 @@
 #include "../Other/TestPrefix.h"
 
+#include <numeric>
+#include <thread>
+
 TEST_CASE("LockFreeSource",
           "[LockFreeSource]")
 {
@@ -50,6 +53,244 @@ TEST_CASE("LockFreeSource",
         }
     }
     
+    CONTEXT("bool")
+    {
+        Array<bool> values;
+        LockFreeSource<bool> source(4, false);
+        LockFreeSource<bool> singleProducerSource(4, ProducerPolicy::SingleProducer, false);
+        ReaX_CollectValues(source, values);
+        ReaX_CollectValues(singleProducerSource, values);
+        
+        IT("emits bool values")
+        {
+            source.onNext(true, CongestionPolicy::DropNewest);
+            source.onNext(false, CongestionPolicy::DropNewest);
+            ReaX_RunDispatchLoopUntil(values.size() == 2);
+            singleProducerSource.onNext(true, CongestionPolicy::DropNewest);
+            
+            ReaX_RunDispatchLoopUntil(values.size() == 3);
+            ReaX_RequireValues(values, true, false, true);
+        }
+    }
+    
+    CONTEXT("drain budget")
+    {
+        Array<int> values;
+        LockFreeSource<int> source(1000);
+        ReaX_CollectValues(source, values);
+        
+        Array<int> expected;
+        for (int i = 0; i < 500; ++i)
+            expected.add(i);
+        
+        IT("emits all values in order if the number of values per callback is limited")
+        {
+            source.setDrainBudget(7);
+            for (auto i : expected)
+                source.onNext(i, CongestionPolicy::DropNewest);
+            
+            ReaX_RunDispatchLoopUntil(values.size() == expected.size());
+            REQUIRE(values == expected);
+        }
+        
+        IT("emits all values in order if a subscriber lowers the number of values per callback")
+        {
+            DisposeBag disposeBag;
+            source.setDrainBudget(20);
+            source.subscribe([&](int) { source.setDrainBudget(3); }).disposedBy(disposeBag);
+            for (auto i : expected)
+                source.onNext(i, CongestionPolicy::DropNewest);
+            
+            ReaX_RunDispatchLoopUntil(values.size() == expected.size());
+            REQUIRE(values == expected);
+        }
+        
+        IT("emits all values in order if the duration per callback is limited")
+        {
+            source.setDrainBudget(0, RelativeTime::milliseconds(1));
+            for (auto i : expected)
+                source.onNext(i, CongestionPolicy::DropNewest);
+            
+            ReaX_RunDispatchLoopUntil(values.size() == expected.size());
+            REQUIRE(values == expected);
+        }
+        
+        IT("emits all values in order with a single producer")
+        {
+            LockFreeSource<int> singleProducerSource(16, ProducerPolicy::SingleProducer);
+            Array<int> singleProducerValues;
+            ReaX_CollectValues(singleProducerSource, singleProducerValues);
+            singleProducerSource.setDrainBudget(5);
+            
+            // Some of the values go to the overflow queue
+            for (auto i : expected)
+                singleProducerSource.onNext(i, CongestionPolicy::Allocate);
+            
+            ReaX_RunDispatchLoopUntil(singleProducerValues.size() == expected.size());
+            REQUIRE(singleProducerValues == expected);
+        }
+    }
+    
+    CONTEXT("single producer")
+    {
+        Array<int> values;
+        LockFreeSource<int> source(3, ProducerPolicy::SingleProducer);
+        ReaX_CollectValues(source, values);
+        
+        IT("emits values asynchronously via the Observable")
+        {
+            for (auto i : {4, 58, 18, -3})
+                source.onNext(i, CongestionPolicy::DropNewest);
+            
+            CHECK(values.isEmpty());
+            
+            ReaX_RunDispatchLoopUntil(values.size() == 4);
+            ReaX_RequireValues(values, 4, 58, 18, -3);
+        }
+        
+        IT("can discard the oldest values")
+        {
+            for (int i = 0; i < 100; ++i)
+                source.onNext(i * 17, CongestionPolicy::DropOldest);
+            
+            // The capacity is rounded up to the next power of two
+            ReaX_RunDispatchLoopUntil(values.size() == 4);
+            ReaX_RequireValues(values, 96 * 17, 97 * 17, 98 * 17, 99 * 17);
+        }
+        
+        IT("can discard the newest values")
+        {
+            for (int i = 0; i < 100; ++i)
+                source.onNext(i, CongestionPolicy::DropNewest);
+            
+            ReaX_RunDispatchLoopUntil(values.size() == 4);
+            ReaX_RequireValues(values, 0, 1, 2, 3);
+        }
+        
+        IT("allocates in order if the ring buffer is full")
+        {
+            Array<int> expected;
+            for (int i = 0; i < 100; ++i) {
+                source.onNext(i, CongestionPolicy::Allocate);
+                expected.add(i);
+            }
+            
+            ReaX_RunDispatchLoopUntil(values.size() == 100);
+            REQUIRE(values == expected);
+            
+            // After the overflow values have been emitted, the ring buffer should be used again
+            source.onNext(100, CongestionPolicy::DropNewest);
+            ReaX_RunDispatchLoopUntil(values.size() == 101);
+            REQUIRE(values.getLast() == 100);
+        }
+        
+        IT("keeps the order of values from another thread")
+        {
+            const int numValues = 100000;
+            std::thread producer([&]() {
+                for (int i = 0; i < numValues; ++i)
+                    source.onNext(i, CongestionPolicy::DropOldest);
+                
+                // Allocate never drops a value, so this one is always emitted
+                source.onNext(numValues, CongestionPolicy::Allocate);
+            });
+            
+            ReaX_RunDispatchLoopUntil(!values.isEmpty() && values.getLast() == numValues);
+            producer.join();
+            
+            REQUIRE(values.getLast() == numValues);
+            for (int i = 1; i < values.size(); ++i)
+                REQUIRE(values[i - 1] < values[i]);
+        }
+    }
+    
+    CONTEXT("statistics")
+    {
+        Array<int> values;
+        LockFreeSource<int> source(3, ProducerPolicy::SingleProducer);
+        ReaX_CollectValues(source, values);
+        source.setStatisticsEnabled(true, RelativeTime::milliseconds(10));
+        
+        const auto getNumLatencies = [](const LockFreeSourceStatistics& statistics) {
+            return std::accumulate(statistics.latencyHistogram.begin(), statistics.latencyHistogram.end(), int64(0));
+        };
+        
+        IT("counts enqueued, dropped and emitted values")
+        {
+            for (int i = 0; i < 10; ++i)
+                source.onNext(i, CongestionPolicy::DropNewest);
+            
+            ReaX_RunDispatchLoopUntil(values.size() == 4);
+            
+            const auto statistics = source.getStatistics();
+            CHECK(statistics.numEnqueued == 4);
+            CHECK(statistics.numDropped == 6);
+            CHECK(statistics.numEmitted == 4);
+            CHECK(statistics.highWaterMark == 4);
+            REQUIRE(getNumLatencies(statistics) == 4);
+        }
+        
+        IT("counts the oldest values as dropped")
+        {
+            for (int i = 0; i < 10; ++i)
+                source.onNext(i, CongestionPolicy::DropOldest);
+            
+            ReaX_RunDispatchLoopUntil(values.size() == 4);
+            
+            const auto statistics = source.getStatistics();
+            CHECK(statistics.numEnqueued == 10);
+            CHECK(statistics.numDropped == 6);
+            REQUIRE(statistics.numEmitted == 4);
+        }
+        
+        IT("measures the latency of values in the overflow queue")
+        {
+            for (int i = 0; i < 10; ++i)
+                source.onNext(i, CongestionPolicy::Allocate);
+            
+            ReaX_RunDispatchLoopUntil(values.size() == 10);
+            
+            const auto statistics = source.getStatistics();
+            CHECK(statistics.numEmitted == 10);
+            CHECK(statistics.highWaterMark == 10);
+            REQUIRE(getNumLatencies(statistics) == 10);
+        }
+        
+        IT("emits snapshots periodically")
+        {
+            Array<int64> numEmitted;
+            DisposeBag disposeBag;
+            source.statistics().subscribe([&](const LockFreeSourceStatistics& statistics) { numEmitted.add(statistics.numEmitted); }).disposedBy(disposeBag);
+            source.onNext(1, CongestionPolicy::DropNewest);
+            
+            ReaX_RunDispatchLoopUntil(!numEmitted.isEmpty() && numEmitted.getLast() == 1);
+            REQUIRE(numEmitted.getLast() == 1);
+        }
+        
+        IT("sets all statistics to zero when resetting")
+        {
+            source.onNext(1, CongestionPolicy::DropNewest);
+            ReaX_RunDispatchLoopUntil(values.size() == 1);
+            
+            source.resetStatistics();
+            
+            const auto statistics = source.getStatistics();
+            CHECK(statistics.numEnqueued == 0);
+            CHECK(statistics.numEmitted == 0);
+            CHECK(statistics.highWaterMark == 0);
+            REQUIRE(getNumLatencies(statistics) == 0);
+        }
+        
+        IT("doesn't record anything while disabled")
+        {
+            source.setStatisticsEnabled(false);
+            source.onNext(1, CongestionPolicy::DropNewest);
+            ReaX_RunDispatchLoopUntil(values.size() == 1);
+            
+            REQUIRE(source.getStatistics().numEnqueued == 0);
+        }
+    }
+    
     CONTEXT("move semantics")
     {
         // Create source
@@ -81,3 +322,102 @@ TEST_CASE("LockFreeSource",
         }
     }
 }
+
+TEST_CASE("LockFreeBlockSource",
+          "[LockFreeSource][LockFreeBlockSource]")
+{
+    Array<Array<float>> blocks;
+    LockFreeBlockSource<float> source(4, 2, ProducerPolicy::SingleProducer);
+    DisposeBag disposeBag;
+    source.subscribe([&](const BlockView<float>& block) {
+        blocks.add(Array<float>(block.getData(), static_cast<int>(block.size())));
+    }).disposedBy(disposeBag);
+    
+    const float values[] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+    
+    IT("emits one BlockView per block, and splits large blocks")
+    {
+        source.onNextBatch(values, 3, CongestionPolicy::DropNewest);
+        source.onNextBatch(values, 6, CongestionPolicy::Allocate);
+        CHECK(blocks.isEmpty());
+        
+        ReaX_RunDispatchLoopUntil(blocks.size() == 3);
+        REQUIRE(blocks.size() == 3);
+        CHECK(blocks[0] == Array<float>({ 1.f, 2.f, 3.f }));
+        CHECK(blocks[1] == Array<float>({ 1.f, 2.f, 3.f, 4.f }));
+        CHECK(blocks[2] == Array<float>({ 5.f, 6.f }));
+    }
+    
+    IT("reuses buffers after the BlockViews have been destroyed")
+    {
+        for (int i = 0; i < 10; ++i) {
+            source.onNextBatch(values + (i % 3), 3, CongestionPolicy::DropNewest);
+            ReaX_RunDispatchLoopUntil(blocks.size() == i + 1);
+        }
+        
+        REQUIRE(blocks.size() == 10);
+        CHECK(blocks.getLast() == Array<float>({ 1.f, 2.f, 3.f }));
+    }
+    
+    IT("can be refilled to capacity after draining a full queue")
+    {
+        LockFreeBlockSource<float> largeSource(4, 8, ProducerPolicy::SingleProducer);
+        DisposeBag largeSourceDisposeBag;
+        int numBlocks = 0;
+        largeSource.subscribe([&](const BlockView<float>&) { numBlocks++; }).disposedBy(largeSourceDisposeBag);
+        
+        for (int i = 0; i < 8; ++i)
+            largeSource.onNextBatch(values, 2, CongestionPolicy::DropNewest);
+        
+        ReaX_RunDispatchLoopUntil(numBlocks == 8);
+        REQUIRE(numBlocks == 8);
+        
+        for (int i = 0; i < 8; ++i)
+            largeSource.onNextBatch(values, 2, CongestionPolicy::DropNewest);
+        
+        ReaX_RunDispatchLoopUntil(numBlocks == 16);
+        REQUIRE(numBlocks == 16);
+    }
+    
+    IT("drops blocks if no buffer is free, unless allocation is allowed")
+    {
+        // Keep BlockViews of all 4 buffers (queue capacity + 2) alive
+        Array<BlockView<float>> keptBlocks;
+        source.subscribe([&](const BlockView<float>& block) { keptBlocks.add(block); }).disposedBy(disposeBag);
+        for (int i = 0; i < 4; ++i) {
+            source.onNextBatch(values, 2, CongestionPolicy::DropNewest);
+            ReaX_RunDispatchLoopUntil(blocks.size() == i + 1);
+        }
+        
+        REQUIRE(blocks.size() == 4);
+        
+        source.onNextBatch(values, 2, CongestionPolicy::DropNewest);
+        ReaX_RunDispatchLoop(20);
+        CHECK(blocks.size() == 4);
+        
+        source.onNextBatch(values, 2, CongestionPolicy::Allocate);
+        ReaX_RunDispatchLoopUntil(blocks.size() == 5);
+        REQUIRE(blocks.size() == 5);
+    }
+    
+    IT("counts blocks that are dropped because no buffer is free")
+    {
+        source.setStatisticsEnabled(true);
+        
+        // Keep BlockViews of all 4 buffers (queue capacity + 2) alive
+        Array<BlockView<float>> keptBlocks;
+        source.subscribe([&](const BlockView<float>& block) { keptBlocks.add(block); }).disposedBy(disposeBag);
+        for (int i = 0; i < 4; ++i) {
+            source.onNextBatch(values, 2, CongestionPolicy::DropNewest);
+            ReaX_RunDispatchLoopUntil(blocks.size() == i + 1);
+        }
+        
+        CHECK(source.getStatistics().numDropped == 0);
+        
+        source.onNextBatch(values, 2, CongestionPolicy::DropNewest);
+        
+        const auto statistics = source.getStatistics();
+        CHECK(statistics.numEnqueued == 4);
+        REQUIRE(statistics.numDropped == 1);
+    }
+}
@@ -1,5 +1,7 @@
 #include "../Other/TestPrefix.h"
 
+#include <thread>
+
 TEST_CASE("LockFreeTarget",
           "[LockFreeTarget][ReleasePool]")
 {
@@ -159,4 +161,276 @@ TEST_CASE("LockFreeTarget",
             }
         }
     }
+    
+    CONTEXT("bounded queue")
+    {
+        auto enqueueAndDequeue = [](LockFreeTarget<int>& target, int numValues) -> Array<int> {
+            for (int i = 0; i < numValues; ++i)
+                target.onNext(i);
+            
+            Array<int> values;
+            int value;
+            while (target.tryDequeue(value))
+                values.add(value);
+            
+            return values;
+        };
+        
+        IT("retrieves values in order if the queue doesn't overflow")
+        {
+            LockFreeTarget<int> target(4, CongestionPolicy::DropNewest);
+            REQUIRE(enqueueAndDequeue(target, 4) == Array<int>({ 0, 1, 2, 3 }));
+        }
+        
+        IT("drops the newest values with CongestionPolicy::DropNewest")
+        {
+            LockFreeTarget<int> target(4, CongestionPolicy::DropNewest);
+            REQUIRE(enqueueAndDequeue(target, 10) == Array<int>({ 0, 1, 2, 3 }));
+        }
+        
+        IT("drops the oldest values with CongestionPolicy::DropOldest")
+        {
+            LockFreeTarget<int> target(4, CongestionPolicy::DropOldest);
+            REQUIRE(enqueueAndDequeue(target, 10) == Array<int>({ 6, 7, 8, 9 }));
+        }
+        
+        IT("keeps all values in order with CongestionPolicy::Allocate")
+        {
+            LockFreeTarget<int> target(4, CongestionPolicy::Allocate);
+            REQUIRE(enqueueAndDequeue(target, 10) == Array<int>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+            
+            IT("uses the ring buffer again after the overflow values have been dequeued")
+            {
+                REQUIRE(enqueueAndDequeue(target, 3) == Array<int>({ 0, 1, 2 }));
+            }
+        }
+        
+        IT("rounds the capacity up to the next power of two")
+        {
+            LockFreeTarget<int> target(3, CongestionPolicy::DropNewest);
+            REQUIRE(enqueueAndDequeue(target, 5) == Array<int>({ 0, 1, 2, 3 }));
+        }
+        
+        IT("keeps the latest value when dequeueing all values")
+        {
+            PublishSubject<String> subject;
+            LockFreeTarget<String> target(2, CongestionPolicy::DropOldest);
+            subject.subscribe(target);
+            
+            subject.onNext("This should be discarded.");
+            subject.onNext("This should be discarded, too.");
+            subject.onNext("Hello");
+            
+            String value;
+            CHECK(target.tryDequeueAll(value));
+            REQUIRE(value == "Hello");
+        }
+        
+        IT("transfers values to another thread without dropping any")
+        {
+            const int numValues = 10000;
+            LockFreeTarget<int> target(16, CongestionPolicy::Allocate);
+            
+            bool isInOrder = true;
+            std::thread consumer([&]() {
+                int expected = 0;
+                int value;
+                while (expected < numValues) {
+                    if (target.tryDequeue(value)) {
+                        isInOrder = isInOrder && (value == expected);
+                        ++expected;
+                    }
+                }
+            });
+            
+            for (int i = 0; i < numValues; ++i)
+                target.onNext(i);
+            
+            consumer.join();
+            REQUIRE(isInOrder);
+        }
+    }
+}
+
+TEST_CASE("LatestValueTarget",
+          "[LockFreeTarget][LatestValueTarget]")
+{
+    IT("returns the initial value before retrieving a value")
+    {
+        LatestValueTarget<String> target("initial");
+        String value("untouched");
+        CHECK_FALSE(target.tryGetNewValue(value));
+        CHECK(value == "untouched");
+        REQUIRE(target.getLatestValue() == "initial");
+    }
+    
+    IT("keeps only the latest value")
+    {
+        PublishSubject<String> subject;
+        LatestValueTarget<String> target;
+        subject.subscribe(target);
+        
+        subject.onNext("This should be discarded.");
+        subject.onNext("This should be discarded, too.");
+        subject.onNext("Hello");
+        
+        String value;
+        CHECK(target.tryGetNewValue(value));
+        CHECK(value == "Hello");
+        
+        // There should be no new value now
+        CHECK_FALSE(target.tryGetNewValue(value));
+        CHECK(target.getLatestValue() == "Hello");
+        
+        subject.onNext("World!");
+        CHECK(target.getLatestValue() == "World!");
+        REQUIRE_FALSE(target.tryGetNewValue(value));
+    }
+    
+    IT("can convert between convertible types")
+    {
+        LatestValueTarget<int> target;
+        int64 value = 0;
+        
+        target.onNext(312);
+        CHECK(target.tryGetNewValue(value));
+        REQUIRE(value == 312);
+    }
+    
+    IT("never returns an older value when reading from another thread")
+    {
+        LatestValueTarget<int> target(-1);
+        const int numValues = 100000;
+        std::atomic<bool> hasReadOlderValue(false);
+        
+        std::thread reader([&]() {
+            int previous = -1;
+            while (previous < numValues - 1) {
+                const int latest = target.getLatestValue();
+                if (latest < previous)
+                    hasReadOlderValue = true;
+                
+                previous = latest;
+            }
+        });
+        
+        for (int i = 0; i < numValues; ++i)
+            target.onNext(i);
+        
+        reader.join();
+        REQUIRE_FALSE(hasReadOlderValue);
+    }
+}
+
+TEST_CASE("SmoothedValueTarget",
+          "[LockFreeTarget][SmoothedValueTarget]")
+{
+    IT("starts with the initial value")
+    {
+        SmoothedValueTarget<float> target(0.5f);
+        CHECK(target.getCurrentValue() == 0.5f);
+        CHECK(target.getNextValue() == 0.5f);
+        REQUIRE_FALSE(target.isSmoothing());
+    }
+    
+    IT("jumps to new values before the ramp length has been set")
+    {
+        SmoothedValueTarget<float> target;
+        target.onNext(0.75f);
+        REQUIRE(target.getNextValue() == 0.75f);
+    }
+    
+    CONTEXT("linear ramp")
+    {
+        SmoothedValueTarget<float> target;
+        
+        // Ramps take 4 samples
+        target.reset(1000, 0.004);
+        
+        IT("fills a ramp to a new value, followed by the new value")
+        {
+            target.onNext(1);
+            
+            float values[6];
+            target.fillRamp(values, 6);
+            
+            CHECK(Array<float>(values, 6) == Array<float>({ 0.25f, 0.5f, 0.75f, 1, 1, 1 }));
+            CHECK(target.getCurrentValue() == 1);
+            REQUIRE_FALSE(target.isSmoothing());
+        }
+        
+        IT("continues a ramp across several blocks")
+        {
+            target.onNext(1);
+            
+            float values[3];
+            target.fillRamp(values, 2);
+            CHECK(Array<float>(values, 2) == Array<float>({ 0.25f, 0.5f }));
+            CHECK(target.isSmoothing());
+            
+            target.fillRamp(values, 3);
+            REQUIRE(Array<float>(values, 3) == Array<float>({ 0.75f, 1, 1 }));
+        }
+        
+        IT("returns the same values from getNextValue as from fillRamp")
+        {
+            target.onNext(-1);
+            
+            Array<float> values;
+            for (int i = 0; i < 5; ++i)
+                values.add(target.getNextValue());
+            
+            REQUIRE(values == Array<float>({ -0.25f, -0.5f, -0.75f, -1, -1 }));
+        }
+        
+        IT("starts a new ramp from the current value when retrieving a value during a ramp")
+        {
+            target.onNext(1);
+            target.getNextValue();
+            target.getNextValue();
+            
+            target.onNext(-0.5f);
+            
+            Array<float> values;
+            for (int i = 0; i < 4; ++i)
+                values.add(target.getNextValue());
+            
+            REQUIRE(values == Array<float>({ 0.25f, 0, -0.25f, -0.5f }));
+        }
+        
+        IT("only uses the latest retrieved value")
+        {
+            target.onNext(-3);
+            target.onNext(1);
+            
+            float values[4];
+            target.fillRamp(values, 4);
+            REQUIRE(Array<float>(values, 4) == Array<float>({ 0.25f, 0.5f, 0.75f, 1 }));
+        }
+        
+        IT("jumps to the latest value when resetting")
+        {
+            target.onNext(1);
+            target.getNextValue();
+            target.reset(1000, 0.004);
+            
+            CHECK(target.getCurrentValue() == 1);
+            REQUIRE_FALSE(target.isSmoothing());
+        }
+    }
+    
+    IT("ramps multiplicatively")
+    {
+        SmoothedValueTarget<double> target(1, SmoothingType::Multiplicative);
+        target.reset(1000, 0.003);
+        target.onNext(8);
+        
+        double values[4];
+        target.fillRamp(values, 4);
+        
+        CHECK(values[0] == Approx(2));
+        CHECK(values[1] == Approx(4));
+        CHECK(values[2] == 8);
+        REQUIRE(values[3] == 8);
+    }
 }
@@ -13,6 +13,41 @@ String concatStrings<String>(String s)
     return s;
 }
 
+TEST_CASE("Observable::bufferCount",
+          "[Observable][Observable::bufferCount]")
+{
+    Array<Array<int>> values;
+    
+    IT("emits blocks of values, and the remaining values on completion")
+    {
+        ReaX_CollectValues(Observable<int>::range(1, 7).bufferCount(3), values);
+        
+        REQUIRE(values.size() == 3);
+        CHECK(values[0] == Array<int>({ 1, 2, 3 }));
+        CHECK(values[1] == Array<int>({ 4, 5, 6 }));
+        CHECK(values[2] == Array<int>({ 7 }));
+    }
+}
+
+TEST_CASE("Observable::bufferTime",
+          "[Observable][Observable::bufferTime]")
+{
+    Array<Array<int>> values;
+    PublishSubject<int> subject;
+    
+    IT("emits the values from each period")
+    {
+        ReaX_CollectValues(subject.bufferTime(RelativeTime::milliseconds(20)), values);
+        
+        subject.onNext(1);
+        subject.onNext(2);
+        subject.onCompleted();
+        
+        ReaX_RunDispatchLoopUntil(!values.isEmpty());
+        REQUIRE(values.getFirst() == Array<int>({ 1, 2 }));
+    }
+}
+
 TEST_CASE("Observable::combineLatest",
           "[Observable][Observable::combineLatest]")
 {
@@ -255,6 +290,87 @@ TEST_CASE("Observable::map",
 }
 
 
+TEST_CASE("Consecutive Observable::map and Observable::filter",
+          "[Observable][Observable::map][Observable::filter]")
+{
+    Array<int> values;
+    PublishSubject<int> subject;
+
+    IT("applies fused operators in order")
+    {
+        auto chain = subject.map([](int i) { return i + 1; })
+                         .filter([](int i) { return (i % 2 == 0); })
+                         .map([](int i) { return i * 10; })
+                         .filter([](int i) { return (i > 20); });
+        ReaX_CollectValues(chain, values);
+
+        for (int i = 0; i < 6; ++i)
+            subject.onNext(i);
+
+        ReaX_RequireValues(values, 40, 60);
+    }
+
+    IT("calls each function once per value")
+    {
+        int numCalls = 0;
+        auto chain = subject.map([&numCalls](int i) {
+                                ++numCalls;
+                                return i;
+                            })
+                         .filter([](int) { return true; })
+                         .map([](int i) { return i; });
+        ReaX_CollectValues(chain, values);
+
+        subject.onNext(7);
+        subject.onNext(8);
+
+        CHECK(numCalls == 2);
+        ReaX_RequireValues(values, 7, 8);
+    }
+
+    IT("keeps branches independent")
+    {
+        auto base = subject.map([](int i) { return i * 2; });
+        auto filtered = base.filter([](int i) { return (i > 4); });
+        auto mapped = base.map([](int i) { return i + 1; });
+
+        Array<int> baseValues, filteredValues, mappedValues;
+        ReaX_CollectValues(base, baseValues);
+        ReaX_CollectValues(filtered, filteredValues);
+        ReaX_CollectValues(mapped, mappedValues);
+
+        subject.onNext(1);
+        subject.onNext(3);
+
+        ReaX_CheckValues(baseValues, 2, 6);
+        ReaX_CheckValues(filteredValues, 6);
+        ReaX_RequireValues(mappedValues, 3, 7);
+    }
+
+    IT("notifies onError if a fused function throws")
+    {
+        bool onErrorCalled = false;
+        DisposeBag disposeBag;
+        subject.map([](int i) { return i; })
+            .filter([](int i) -> bool {
+                if (i > 2)
+                    throw std::runtime_error("Too large.");
+
+                return true;
+            })
+            .subscribe([&](int i) { values.add(i); }, [&](std::exception_ptr) { onErrorCalled = true; })
+            .disposedBy(disposeBag);
+
+        subject.onNext(1);
+        subject.onNext(3);
+        subject.onNext(2);
+
+        ReaX_CheckValues(values, 1);
+        REQUIRE(onErrorCalled);
+    }
+}
+
+
 TEST_CASE("Interaction between Observable::map and Observable::switchOnNext",
           "[Observable][Observable::map][Observable::switchOnNext]")
 {
@@ -545,3 +661,129 @@ TEST_CASE("Observable::zip",
         ReaX_RequireValues(values, "s=a; i=1; d=0.1", "s=x; i=57; d=0.25");
     }
 }
+
+
+TEST_CASE("Operators with an Array of Observables",
+          "[Observable][Observable::combineLatest][Observable::zip][Observable::merge][Observable::concat]")
+{
+    const int numObservables = 64;
+    OwnedArray<PublishSubject<int>> subjects;
+    Array<Observable<int>> observables;
+    for (int i = 0; i < numObservables; ++i)
+        observables.add(*subjects.add(new PublishSubject<int>()));
+
+    IT("combines the latest values with combineLatest")
+    {
+        Array<Array<int>> values;
+        ReaX_CollectValues(Observable<int>::combineLatest(observables), values);
+
+        // Should only emit when all Observables have emitted
+        for (int i = 0; i < numObservables; ++i) {
+            CHECK(values.isEmpty());
+            subjects[i]->onNext(i);
+        }
+
+        REQUIRE(values.size() == 1);
+        CHECK(values.getFirst().size() == numObservables);
+        CHECK(values.getFirst()[17] == 17);
+
+        // Then, each new value should update only its own element
+        subjects[17]->onNext(1000);
+        REQUIRE(values.size() == 2);
+        CHECK(values.getLast()[16] == 16);
+        CHECK(values.getLast()[17] == 1000);
+        CHECK(values.getLast()[18] == 18);
+    }
+
+    IT("calls the function with the latest values")
+    {
+        Array<int> sums;
+        const auto sum = [](const Array<int>& latestValues) -> int {
+            int total = 0;
+            for (auto value : latestValues)
+                total += value;
+
+            return total;
+        };
+        ReaX_CollectValues(Observable<int>::combineLatest(observables, sum), sums);
+
+        for (auto subject : subjects)
+            subject->onNext(1);
+
+        subjects[3]->onNext(10);
+        ReaX_RequireValues(sums, numObservables, numObservables + 9);
+    }
+
+    IT("completes combineLatest when all Observables have completed")
+    {
+        bool completed = false;
+        auto subscription = Observable<int>::combineLatest(observables).subscribe([](const Array<int>&) {}, [](std::exception_ptr) {}, [&]() { completed = true; });
+
+        for (int i = 0; i < numObservables - 1; ++i)
+            subjects[i]->onCompleted();
+
+        CHECK(!completed);
+        subjects.getLast()->onCompleted();
+        CHECK(completed);
+        subscription.unsubscribe();
+    }
+
+    IT("combines values in sequence with zip")
+    {
+        Array<int> sums;
+        const auto sum = [](const Array<int>& values) -> int {
+            int total = 0;
+            for (auto value : values)
+                total += value;
+
+            return total;
+        };
+        ReaX_CollectValues(Observable<int>::zip(observables, sum), sums);
+
+        subjects[0]->onNext(1);
+        subjects[0]->onNext(2);
+        for (int i = 1; i < numObservables; ++i) {
+            CHECK(sums.isEmpty());
+            subjects[i]->onNext(0);
+        }
+
+        ReaX_CheckValues(sums, 1);
+
+        for (int i = 1; i < numObservables; ++i)
+            subjects[i]->onNext(0);
+
+        ReaX_RequireValues(sums, 1, 2);
+    }
+
+    IT("merges values with merge")
+    {
+        Array<int> values;
+        ReaX_CollectValues(Observable<int>::merge(observables), values);
+
+        subjects[5]->onNext(5);
+        subjects[63]->onNext(63);
+        subjects[0]->onNext(0);
+        ReaX_RequireValues(values, 5, 63, 0);
+    }
+
+    IT("concatenates values with concat")
+    {
+        Array<int> values;
+        Array<Observable<int>> ranges;
+        for (int i = 0; i < numObservables; ++i)
+            ranges.add(Observable<int>::just(i));
+
+        ReaX_CollectValues(Observable<int>::concat(ranges), values);
+
+        REQUIRE(values.size() == numObservables);
+        for (int i = 0; i < numObservables; ++i)
+            CHECK(values[i] == i);
+    }
+
+    IT("completes immediately if there are no Observables")
+    {
+        bool completed = false;
+        Observable<int>::combineLatest(Array<Observable<int>>()).subscribe([](const Array<int>&) {}, [](std::exception_ptr) {}, [&]() { completed = true; });
+        CHECK(completed);
+    }
+}
@@ -64,4 +64,57 @@ TEST_CASE("Observable::observeOn",
 
         ReaX_RequireValues(values, 2, 4, 6);
     }
+
+    IT("can schedule from a background thread to the message thread")
+    {
+        Array<bool> onMessageThread;
+        auto hopped = observable.observeOn(Scheduler::newThread()).observeOn(Scheduler::messageThread()).map([](int) {
+            return MessageManager::getInstance()->isThisTheMessageThread();
+        });
+        ReaX_CollectValues(hopped, onMessageThread);
+
+        ReaX_RunDispatchLoopUntil(onMessageThread.size() == 3);
+
+        ReaX_RequireValues(onMessageThread, true, true, true);
+    }
+
+    IT("can schedule many subscriptions to a thread pool and keep the order of each subscription")
+    {
+        const auto threadPool = Scheduler::threadPool(4);
+        Array<int> expected;
+        for (int i = 0; i < 1000; ++i)
+            expected.add(i);
+
+        const int numSubscriptions = 50;
+        CriticalSection lock;
+        OwnedArray<Array<int>> valuesPerSubscription;
+        SortedSet<Thread::ThreadID> threadIDs;
+        DisposeBag disposeBag;
+        for (int i = 0; i < numSubscriptions; ++i) {
+            auto subscriptionValues = valuesPerSubscription.add(new Array<int>());
+            Observable<int>::from(expected).observeOn(threadPool).subscribe([&, subscriptionValues](int value) {
+                const ScopedLock sl(lock);
+                subscriptionValues->add(value);
+                threadIDs.add(Thread::getCurrentThreadId());
+            }).disposedBy(disposeBag);
+        }
+
+        const auto isDone = [&]() -> bool {
+            const ScopedLock sl(lock);
+            for (auto subscriptionValues : valuesPerSubscription) {
+                if (subscriptionValues->size() < expected.size())
+                    return false;
+            }
+
+            return true;
+        };
+        ReaX_RunDispatchLoopUntil(isDone());
+
+        const ScopedLock sl(lock);
+        for (auto subscriptionValues : valuesPerSubscription)
+            REQUIRE(*subscriptionValues == expected);
+
+        CHECK(threadIDs.size() <= 4);
+        CHECK(!threadIDs.contains(Thread::getCurrentThreadId()));
+    }
 }
@@ -0,0 +1,92 @@
+#include "../../Other/TestPrefix.h"
+
+
+TEST_CASE("TypedObservable",
+          "[Observable][TypedObservable]")
+{
+    Array<int> values;
+    PublishSubject<int> subject;
+
+    IT("emits the values of the source Observable")
+    {
+        ReaX_CollectValues(subject.typed(), values);
+
+        subject.onNext(3);
+        subject.onNext(-17);
+
+        ReaX_RequireValues(values, 3, -17);
+    }
+
+    IT("applies a chain of operators")
+    {
+        auto chain = subject.typed()
+                         .map([](int i) { return i * 3; })
+                         .filter([](int i) { return (i % 2 == 0); })
+                         .distinctUntilChanged()
+                         .skip(1);
+        ReaX_CollectValues(chain, values);
+
+        for (auto i : { 1, 2, 2, 3, 4, 4, 6 })
+            subject.onNext(i);
+
+        ReaX_RequireValues(values, 12, 18);
+    }
+
+    IT("can change the value type")
+    {
+        Array<String> strings;
+        ReaX_CollectValues(subject.typed().map([](int i) { return String(i) + "!"; }), strings);
+
+        subject.onNext(5);
+        subject.onNext(8);
+
+        ReaX_RequireValues(strings, "5!", "8!");
+    }
+
+    IT("keeps the state of stateful operators per subscription")
+    {
+        Observable<int> sums = subject.typed().scan(0, [](int accumulator, int i) { return accumulator + i; });
+
+        Array<int> otherValues;
+        ReaX_CollectValues(sums, values);
+        subject.onNext(4);
+        subject.onNext(5);
+
+        ReaX_CollectValues(sums, otherValues);
+        subject.onNext(1);
+
+        ReaX_CheckValues(values, 4, 9, 10);
+        ReaX_RequireValues(otherValues, 1);
+    }
+
+    IT("can use a custom equality function for distinctUntilChanged")
+    {
+        ReaX_CollectValues(subject.typed().distinctUntilChanged([](int lhs, int rhs) { return (lhs / 10 == rhs / 10); }), values);
+
+        for (auto i : { 1, 5, 12, 19, 3 })
+            subject.onNext(i);
+
+        ReaX_RequireValues(values, 1, 12, 3);
+    }
+
+    IT("notifies onError if an operator throws")
+    {
+        bool onErrorCalled = false;
+        DisposeBag disposeBag;
+        subject.typed()
+            .map([](int i) -> int {
+                if (i > 2)
+                    throw std::runtime_error("Too large.");
+
+                return i;
+            })
+            .subscribe([&](int i) { values.add(i); }, [&](std::exception_ptr) { onErrorCalled = true; })
+            .disposedBy(disposeBag);
+
+        subject.onNext(1);
+        subject.onNext(3);
+
+        ReaX_CheckValues(values, 1);
+        REQUIRE(onErrorCalled);
+    }
+}
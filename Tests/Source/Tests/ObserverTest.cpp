@@ -40,6 +40,21 @@ TEST_CASE("Observer",
         REQUIRE(completed);
     }
 
+    IT("can be created from a function")
+    {
+        Array<int> values;
+        Observer<int> observer([&](int value) { values.add(value); });
+
+        observer.onNext(17);
+        Observable<int>::from({ 3, 4 }).subscribe(observer);
+
+        CHECK(values == Array<int>({ 17, 3, 4 }));
+
+        // The Observable has completed the Observer, so it ignores further values
+        observer.onNext(5);
+        REQUIRE(values == Array<int>({ 17, 3, 4 }));
+    }
+
     IT("can subscribe to an Observable")
     {
         DisposeBag disposeBag;
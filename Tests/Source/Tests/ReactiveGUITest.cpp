@@ -74,6 +74,41 @@ TEST_CASE("Reactive<Component>",
             }
         }
     }
+
+    CONTEXT("applying values at frame rate")
+    {
+        component.rx.applyValuesAtFrameRate(60);
+
+        IT("applies only the latest value per property in the next frame")
+        {
+            Array<Rectangle<int>> appliedBounds;
+            ReaX_CollectValues(component.rx.bounds, appliedBounds);
+
+            component.rx.bounds.onNext(Rectangle<int>(1, 2, 3, 4));
+            component.rx.bounds.onNext(Rectangle<int>(5, 6, 7, 8));
+            component.rx.visible.onNext(true);
+
+            // The subjects emit immediately, but the Component doesn't change yet
+            CHECK(appliedBounds.getLast() == Rectangle<int>(5, 6, 7, 8));
+            CHECK(component.getBounds() == Rectangle<int>());
+            CHECK_FALSE(component.isVisible());
+
+            ReaX_RunDispatchLoopUntil(component.getBounds() == Rectangle<int>(5, 6, 7, 8));
+            REQUIRE(component.isVisible());
+        }
+
+        IT("applies pending values when switching back to applying values immediately")
+        {
+            component.rx.bounds.onNext(Rectangle<int>(1, 2, 3, 4));
+            CHECK(component.getBounds() == Rectangle<int>());
+
+            component.rx.applyValuesImmediately();
+            CHECK(component.getBounds() == Rectangle<int>(1, 2, 3, 4));
+
+            component.rx.bounds.onNext(Rectangle<int>(5, 6, 7, 8));
+            REQUIRE(component.getBounds() == Rectangle<int>(5, 6, 7, 8));
+        }
+    }
 }
 
 
@@ -427,6 +462,23 @@ TEST_CASE("Reactive<Label>",
 
             REQUIRE(label.getFont() == font2);
         }
+
+        IT("stops changing the font when the Label is destroyed")
+        {
+            PublishSubject<Font> fonts;
+            auto otherLabel = std::make_shared<Reactive<Label>>();
+            fonts.subscribe(otherLabel->rx.font);
+            fonts.subscribe(label.rx.font);
+
+            fonts.onNext(font1);
+            CHECK(otherLabel->getFont() == font1);
+            CHECK(label.getFont() == font1);
+
+            otherLabel.reset();
+            fonts.onNext(font2);
+
+            REQUIRE(label.getFont() == font2);
+        }
     }
 
     CONTEXT("justificationType")
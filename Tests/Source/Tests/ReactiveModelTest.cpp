@@ -1,5 +1,7 @@
 #include "../Other/TestPrefix.h"
 
+#include <thread>
+
 
 TEST_CASE("Reactive<Value> conversion",
           "[Reactive<Value>][ValueExtension]")
@@ -189,4 +191,128 @@ TEST_CASE("Reactive<AudioProcessorValueTreeState>",
             }
         }
     }
+    
+    CONTEXT("parameter handles")
+    {
+        const auto fooHandle = valueTreeState.rx.parameterHandle("foo");
+        const auto barHandle = valueTreeState.rx.parameterHandle("bar");
+        
+        IT("is invalid when default-constructed")
+        {
+            REQUIRE_FALSE(AudioProcessorValueTreeStateExtension::ParameterHandle().isValid());
+            REQUIRE(fooHandle.isValid());
+            REQUIRE(barHandle.isValid());
+        }
+        
+        IT("returns the same subject as when using the parameter ID")
+        {
+            valueTreeState.rx.parameterValue(fooHandle).onNext(4.5f);
+            ReaX_RequireValues(fooValues, var(), var(4.5f));
+            REQUIRE(valueTreeState.rx.parameterValue("foo").getValue() == var(4.5f));
+        }
+        
+        IT("returns the same handle for the same parameter ID")
+        {
+            valueTreeState.rx.parameterValue(valueTreeState.rx.parameterHandle("bar")).onNext(1.5f);
+            REQUIRE(valueTreeState.rx.parameterValue(barHandle).getValue() == var(1.5f));
+        }
+        
+        IT("returns the default value as raw value, without waiting for the ValueTree")
+        {
+            REQUIRE(valueTreeState.rx.rawParameterValue(fooHandle) == Approx(2.74));
+            REQUIRE(valueTreeState.rx.rawParameterValue(barHandle) == Approx(8.448));
+        }
+        
+        IT("updates the raw value synchronously when setting a new value on the AudioProcessorParameter")
+        {
+            valueTreeState.getParameter("foo")->setValue(0.5f);
+            REQUIRE(valueTreeState.rx.rawParameterValue(fooHandle) == Approx(5));
+            REQUIRE(valueTreeState.rx.rawParameterValue(barHandle) == Approx(8.448));
+        }
+        
+        IT("updates the raw value when setting a new value on the subject")
+        {
+            // JUCE updates the value tree state asynchronously. Wait for the first update:
+            ReaX_RunDispatchLoopUntil(valueTreeState.rx.parameterValue(barHandle).getValue() != var());
+            
+            valueTreeState.rx.parameterValue(barHandle).onNext(6.25f);
+            REQUIRE(valueTreeState.rx.rawParameterValue(barHandle) == Approx(6.25));
+        }
+        
+        IT("updates the raw value when setting the parameter from another thread")
+        {
+            std::thread([&]() { valueTreeState.getParameter("bar")->setValue(0.1f); }).join();
+            REQUIRE(valueTreeState.rx.rawParameterValue(barHandle) == Approx(1));
+        }
+        
+        CONTEXT("raw parameter values")
+        {
+            Array<float> rawFooValues;
+            ReaX_CollectValues(valueTreeState.rx.rawParameterValues(fooHandle), rawFooValues);
+            
+            IT("emits the current value synchronously")
+            {
+                REQUIRE(rawFooValues.size() == 1);
+                REQUIRE(rawFooValues.getFirst() == Approx(2.74));
+            }
+            
+            IT("emits a new value on the next frame")
+            {
+                valueTreeState.getParameter("foo")->setValue(0.5f);
+                CHECK(rawFooValues.size() == 1);
+                
+                ReaX_RunDispatchLoopUntil(rawFooValues.size() == 2);
+                REQUIRE(rawFooValues.getLast() == Approx(5));
+            }
+            
+            IT("only emits the latest value if the parameter changes several times within a frame")
+            {
+                std::thread([&]() {
+                    for (int i = 1; i <= 10; ++i)
+                        valueTreeState.getParameter("foo")->setValue(i / 20.f);
+                }).join();
+                
+                ReaX_RunDispatchLoopUntil(rawFooValues.size() == 2);
+                ReaX_RunDispatchLoop(50);
+                REQUIRE(rawFooValues.size() == 2);
+                REQUIRE(rawFooValues.getLast() == Approx(5));
+            }
+            
+            IT("does not emit when a different parameter changes")
+            {
+                valueTreeState.getParameter("bar")->setValue(0.2f);
+                ReaX_RunDispatchLoop(50);
+                REQUIRE(rawFooValues.size() == 1);
+            }
+        }
+    }
+    
+    CONTEXT("parameter handle created while the parameter is automated")
+    {
+        // Change the parameter on another thread while the handle is created and before the first frame
+        std::atomic<bool> isAutomating{ true };
+        std::thread automation([&]() {
+            for (int i = 1; isAutomating.load(); ++i)
+                valueTreeState.getParameter("foo")->setValue((i % 10) / 10.f);
+        });
+        
+        const auto fooHandle = valueTreeState.rx.parameterHandle("foo");
+        Array<float> rawFooValues;
+        ReaX_CollectValues(valueTreeState.rx.rawParameterValues(fooHandle), rawFooValues);
+        
+        isAutomating = false;
+        automation.join();
+        const float latestValue = *valueTreeState.getRawParameterValue("foo");
+        
+        IT("has the latest raw value")
+        {
+            REQUIRE(valueTreeState.rx.rawParameterValue(fooHandle) == Approx(latestValue));
+        }
+        
+        IT("emits the latest value on the next frame")
+        {
+            ReaX_RunDispatchLoop(50);
+            REQUIRE(rawFooValues.getLast() == Approx(latestValue));
+        }
+    }
 }
@@ -0,0 +1,225 @@
+#include "../Other/TestPrefix.h"
+
+#include <thread>
+
+#if REAX_ENABLE_REALTIME_CHECKS
+namespace {
+StringArray violations;
+
+void recordViolation(const char* operation)
+{
+    violations.add(operation);
+}
+
+// A value that doesn't fit into the inline storage of an Observable value
+struct LargeValue
+{
+    char data[REAX_ANY_INLINE_STORAGE_SIZE + 1];
+
+    bool operator==(const LargeValue&) const { return true; }
+};
+}
+#endif
+
+TEST_CASE("ScopedRealtimeThread",
+          "[ScopedRealtimeThread]")
+{
+    IT("marks the current thread as a realtime thread while it exists")
+    {
+        REQUIRE_FALSE(ScopedRealtimeThread::isRealtimeThread());
+
+        {
+            const ScopedRealtimeThread realtimeThread;
+            REQUIRE(ScopedRealtimeThread::isRealtimeThread());
+
+            {
+                const ScopedRealtimeThread nested;
+                REQUIRE(ScopedRealtimeThread::isRealtimeThread());
+            }
+
+            REQUIRE(ScopedRealtimeThread::isRealtimeThread());
+        }
+
+        REQUIRE_FALSE(ScopedRealtimeThread::isRealtimeThread());
+    }
+
+    IT("doesn't mark other threads")
+    {
+        const ScopedRealtimeThread realtimeThread;
+
+        bool isOtherThreadRealtime = true;
+        std::thread([&]() { isOtherThreadRealtime = ScopedRealtimeThread::isRealtimeThread(); }).join();
+
+        REQUIRE_FALSE(isOtherThreadRealtime);
+    }
+
+#if REAX_ENABLE_REALTIME_CHECKS
+    violations.clear();
+    ScopedRealtimeThread::setViolationHandler(&recordViolation);
+
+    CONTEXT("realtime-safe APIs")
+    {
+        IT("doesn't report LockFreeSource::onNext with a single producer")
+        {
+            LockFreeSource<float> source(4, ProducerPolicy::SingleProducer);
+            {
+                const ScopedRealtimeThread realtimeThread;
+                for (int i = 0; i < 8; ++i) {
+                    source.onNext(static_cast<float>(i), CongestionPolicy::DropNewest);
+                    source.onNext(static_cast<float>(i), CongestionPolicy::DropOldest);
+                }
+            }
+
+            REQUIRE(violations.isEmpty());
+        }
+
+        IT("doesn't report LockFreeSource::onNext with multiple producers, if each thread has called it before")
+        {
+            LockFreeSource<float> source(4, ProducerPolicy::MultipleProducers);
+            source.onNext(0.f, CongestionPolicy::DropNewest);
+            {
+                const ScopedRealtimeThread realtimeThread;
+                for (int i = 0; i < 8; ++i) {
+                    source.onNext(static_cast<float>(i), CongestionPolicy::DropNewest);
+                    source.onNext(static_cast<float>(i), CongestionPolicy::DropOldest);
+                }
+            }
+
+            REQUIRE(violations.isEmpty());
+        }
+
+        IT("doesn't report LockFreeBlockSource::onNextBatch")
+        {
+            LockFreeBlockSource<float> source(64, 4, ProducerPolicy::SingleProducer);
+            const std::vector<float> block(64, 0.5f);
+            {
+                const ScopedRealtimeThread realtimeThread;
+                for (int i = 0; i < 8; ++i)
+                    source.onNextBatch(block.data(), block.size(), CongestionPolicy::DropNewest);
+            }
+
+            REQUIRE(violations.isEmpty());
+        }
+
+        IT("doesn't report LockFreeTarget::tryDequeue with a primitive value")
+        {
+            PublishSubject<float> subject;
+            LockFreeTarget<float> target(8, CongestionPolicy::DropOldest);
+            subject.subscribe(target);
+            subject.onNext(1.f);
+            subject.onNext(2.f);
+
+            float value = 0;
+            {
+                const ScopedRealtimeThread realtimeThread;
+                CHECK(target.tryDequeueAll(value));
+            }
+
+            REQUIRE(value == 2.f);
+            REQUIRE(violations.isEmpty());
+        }
+
+        IT("doesn't report LatestValueTarget and SmoothedValueTarget")
+        {
+            PublishSubject<float> subject;
+            LatestValueTarget<float> latestValue(0.f);
+            SmoothedValueTarget<float> smoothedValue(0.f);
+            subject.subscribe(latestValue);
+            subject.subscribe(smoothedValue);
+            subject.onNext(1.f);
+
+            std::vector<float> block(64);
+            {
+                const ScopedRealtimeThread realtimeThread;
+                CHECK(latestValue.getLatestValue() == 1.f);
+                smoothedValue.fillRamp(block.data(), static_cast<int>(block.size()));
+            }
+
+            REQUIRE(violations.isEmpty());
+        }
+    }
+
+    CONTEXT("APIs that aren't realtime-safe")
+    {
+        IT("reports Observer::onNext")
+        {
+            PublishSubject<int> subject;
+            {
+                const ScopedRealtimeThread realtimeThread;
+                subject.onNext(1);
+            }
+
+            REQUIRE(violations.contains("Calling Observer::onNext"));
+        }
+
+        IT("reports subscribing to a Subject")
+        {
+            PublishSubject<int> subject;
+            {
+                const ScopedRealtimeThread realtimeThread;
+                subject.subscribe([](int) {}).unsubscribe();
+            }
+
+            REQUIRE(violations.contains("Subscribing to a Subject"));
+        }
+
+        IT("reports LockFreeSource::onNext if it has to allocate")
+        {
+            LockFreeSource<float> source(2, ProducerPolicy::SingleProducer);
+            {
+                const ScopedRealtimeThread realtimeThread;
+                for (int i = 0; i < 4; ++i)
+                    source.onNext(static_cast<float>(i), CongestionPolicy::Allocate);
+            }
+
+            REQUIRE(violations.contains("Allocating memory in LockFreeSource::onNext (CongestionPolicy::Allocate)"));
+        }
+
+        IT("reports the first LockFreeSource::onNext from a thread with multiple producers")
+        {
+            LockFreeSource<float> source(4, ProducerPolicy::MultipleProducers);
+            {
+                const ScopedRealtimeThread realtimeThread;
+                source.onNext(0.f, CongestionPolicy::DropNewest);
+            }
+
+            REQUIRE(violations.contains("Calling LockFreeSource::onNext from a new thread (ProducerPolicy::MultipleProducers)"));
+        }
+
+        IT("reports LockFreeTarget::tryDequeue with a value that isn't trivially copyable")
+        {
+            LockFreeTarget<String> target(8, CongestionPolicy::DropOldest);
+            String value;
+            {
+                const ScopedRealtimeThread realtimeThread;
+                target.tryDequeue(value);
+            }
+
+            REQUIRE(violations.contains("Dequeueing a value that isn't trivially copyable in LockFreeTarget::tryDequeue"));
+        }
+
+        IT("reports boxing a large value")
+        {
+            {
+                const ScopedRealtimeThread realtimeThread;
+                const detail::any boxed(LargeValue{});
+                ignoreUnused(boxed);
+            }
+
+            REQUIRE(violations.contains("Boxing a value on the heap (it doesn't fit into the inline storage)"));
+        }
+
+        IT("doesn't report anything outside of a ScopedRealtimeThread")
+        {
+            PublishSubject<int> subject;
+            subject.onNext(1);
+            const detail::any boxed(LargeValue{});
+            ignoreUnused(boxed);
+
+            REQUIRE(violations.isEmpty());
+        }
+    }
+
+    ScopedRealtimeThread::setViolationHandler(nullptr);
+#endif
+}
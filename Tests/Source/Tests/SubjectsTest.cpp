@@ -1,10 +1,45 @@
 #include "../Other/TestPrefix.h"
 
+#include <thread>
+
+namespace {
+// Counts its live instances, e.g. the snapshots of a BehaviorSubject that hold a copy of it
+struct InstanceCounted
+{
+    static std::atomic<int> numInstances;
+
+    explicit InstanceCounted(int value)
+    : value(value)
+    {
+        ++numInstances;
+    }
+
+    InstanceCounted(const InstanceCounted& other)
+    : value(other.value)
+    {
+        ++numInstances;
+    }
+
+    InstanceCounted& operator=(const InstanceCounted&) = default;
+
+    ~InstanceCounted()
+    {
+        --numInstances;
+    }
+
+    bool operator==(const InstanceCounted& other) const { return value == other.value; }
+
+    int value;
+};
+
+std::atomic<int> InstanceCounted::numInstances{ 0 };
+}
 
 TEST_CASE("BehaviorSubject",
           "[Subject][BehaviorSubject]")
 {
     BehaviorSubject<var> subject("Initial Value");
+    DisposeBag disposeBag;
 
     // Subscribe to the subject's Observable
     Array<var> values;
@@ -69,6 +104,69 @@ TEST_CASE("BehaviorSubject",
         subject.onCompleted();
     }
     
+    IT("returns the latest value from another thread while pushing values")
+    {
+        BehaviorSubject<int> subject(0);
+        std::atomic<bool> isDone(false);
+        bool hasReadOlderValue = false;
+
+        std::thread readingThread([&]() {
+            int previous = 0;
+            while (!isDone) {
+                const int value = subject.getValue();
+                hasReadOlderValue = hasReadOlderValue || (value < previous);
+                previous = value;
+            }
+        });
+
+        for (int i = 1; i <= 10000; ++i)
+            subject.onNext(i);
+
+        isDone = true;
+        readingThread.join();
+
+        CHECK_FALSE(hasReadOlderValue);
+        REQUIRE(subject.getValue() == 10000);
+    }
+
+    IT("keeps a bounded number of snapshots while another thread reads the value continuously")
+    {
+        {
+            BehaviorSubject<InstanceCounted> countedSubject(InstanceCounted(0));
+            std::atomic<bool> isDone(false);
+
+            std::thread readingThread([&]() {
+                while (!isDone)
+                    countedSubject.getValue();
+            });
+
+            for (int i = 1; i <= 10000; ++i)
+                countedSubject.onNext(InstanceCounted(i));
+
+            // Each snapshot holds one instance
+            const int numSnapshots = InstanceCounted::numInstances;
+
+            isDone = true;
+            readingThread.join();
+
+            REQUIRE(numSnapshots < 100);
+        }
+
+        REQUIRE(InstanceCounted::numInstances == 0);
+    }
+
+    IT("emits the latest value and subsequent values when subscribing")
+    {
+        BehaviorSubject<int> subject(1);
+        subject.onNext(2);
+
+        Array<int> laterValues;
+        subject.subscribe([&](int value) { laterValues.add(value); }).disposedBy(disposeBag);
+        subject.onNext(3);
+
+        REQUIRE(laterValues == Array<int>({ 2, 3 }));
+    }
+
     IT("can receive an initial value of a custom type, without wrapping with toVar()")
     {
         BehaviorSubject<Point<int>> subject(Point<int>(13, 556));
@@ -171,6 +269,92 @@ TEST_CASE("PublishSubject",
             subject->onCompleted();
         }
     }
+
+    IT("can unsubscribe while emitting a value")
+    {
+        PublishSubject<int> subject;
+        Array<int> values;
+        std::shared_ptr<Subscription> subscription;
+        subscription = std::make_shared<Subscription>(subject.subscribe([&](int value) {
+            values.add(value);
+            subscription->unsubscribe();
+        }));
+
+        subject.onNext(1);
+        subject.onNext(2);
+
+        REQUIRE(values == Array<int>({ 1 }));
+    }
+
+    IT("can subscribe while emitting a value")
+    {
+        PublishSubject<int> subject;
+        Array<int> laterValues;
+        subject.take(1).subscribe([&](int) {
+                           subject.subscribe([&](int value) { laterValues.add(value); }).disposedBy(disposeBag);
+                       })
+            .disposedBy(disposeBag);
+
+        subject.onNext(1);
+        subject.onNext(2);
+
+        REQUIRE(laterValues == Array<int>({ 2 }));
+    }
+
+    IT("emits to all subscribers while other threads subscribe and unsubscribe")
+    {
+        PublishSubject<int> subject;
+        std::atomic<int> numValues(0);
+        subject.subscribe([&](int) { ++numValues; }).disposedBy(disposeBag);
+
+        std::atomic<bool> isDone(false);
+        std::thread subscribingThread([&]() {
+            while (!isDone)
+                subject.subscribe([](int) {}).unsubscribe();
+        });
+
+        std::vector<std::thread> emittingThreads;
+        for (int i = 0; i < 4; ++i) {
+            emittingThreads.emplace_back([&]() {
+                for (int value = 0; value < 1000; ++value)
+                    subject.onNext(value);
+            });
+        }
+
+        for (auto& thread : emittingThreads)
+            thread.join();
+
+        isDone = true;
+        subscribingThread.join();
+
+        REQUIRE(numValues == 4000);
+    }
+
+    IT("releases unsubscribed subscribers while other threads emit continuously")
+    {
+        PublishSubject<int> subject;
+        std::atomic<bool> isDone(false);
+        std::vector<std::thread> emittingThreads;
+        for (int i = 0; i < 4; ++i) {
+            emittingThreads.emplace_back([&]() {
+                while (!isDone)
+                    subject.onNext(1);
+            });
+        }
+
+        // Each subscriber keeps a reference to the token, until its retired array of subscribers is deleted
+        const auto token = std::make_shared<int>(0);
+        for (int i = 0; i < 1000; ++i)
+            subject.subscribe([token](int) {}).unsubscribe();
+
+        const long numReferences = token.use_count();
+
+        isDone = true;
+        for (auto& thread : emittingThreads)
+            thread.join();
+
+        REQUIRE(numReferences < 100);
+    }
 }
 
 
@@ -230,6 +414,68 @@ TEST_CASE("ReplaySubject",
         ReaX_RequireValues(values, 7, 28, 3, 6);
     }
 
+    CONTEXT("with a limited buffer size")
+    {
+        ReplaySubject<int> subject(3);
+
+        IT("emits previous values in order after overwriting old values several times")
+        {
+            for (int i = 0; i < 10; ++i)
+                subject.onNext(i);
+
+            Array<int> laterValues;
+            subject.subscribe([&](int value) { laterValues.add(value); }).disposedBy(disposeBag);
+
+            CHECK(laterValues == Array<int>({ 7, 8, 9 }));
+
+            subject.onNext(10);
+            REQUIRE(laterValues == Array<int>({ 7, 8, 9, 10 }));
+        }
+
+        IT("emits values that are pushed while replaying, after the previous values")
+        {
+            subject.onNext(1);
+            subject.onNext(2);
+
+            Array<int> laterValues;
+            subject.subscribe([&](int value) {
+                       laterValues.add(value);
+
+                       if (value == 1)
+                           subject.onNext(3);
+                   })
+                .disposedBy(disposeBag);
+
+            REQUIRE(laterValues == Array<int>({ 1, 2, 3 }));
+        }
+
+        IT("emits previous values before notifying onCompleted")
+        {
+            subject.onNext(1);
+            subject.onNext(2);
+            subject.onCompleted();
+
+            Array<int> laterValues;
+            bool completed = false;
+            subject.subscribe([&](int value) { laterValues.add(value); }, [](std::exception_ptr) {}, [&]() { completed = true; }).disposedBy(disposeBag);
+
+            CHECK(laterValues == Array<int>({ 1, 2 }));
+            REQUIRE(completed);
+        }
+
+        IT("does not emit previous values with a buffer size of 0")
+        {
+            ReplaySubject<int> subject(0);
+            subject.onNext(1);
+
+            Array<int> laterValues;
+            subject.subscribe([&](int value) { laterValues.add(value); }).disposedBy(disposeBag);
+            subject.onNext(2);
+
+            REQUIRE(laterValues == Array<int>({ 2 }));
+        }
+    }
+
     IT("changes value when changing the Observer")
     {
         subject.onNext(32.51);
@@ -0,0 +1,101 @@
+#include "../Other/TestPrefix.h"
+
+#include <thread>
+
+namespace {
+// Returns the names of all recorded events (excluding metadata)
+StringArray getEventNames()
+{
+    const var trace = JSON::parse(Tracing::getChromeTraceJSON());
+
+    StringArray names;
+    for (auto& event : *trace["traceEvents"].getArray()) {
+        if (event["ph"] != "M")
+            names.add(event["name"]);
+    }
+
+    return names;
+}
+}
+
+TEST_CASE("Tracing",
+          "[Tracing]")
+{
+    IT("is enabled if the module is compiled with REAX_ENABLE_TRACING")
+    {
+        REQUIRE(Tracing::isEnabled() == bool(REAX_ENABLE_TRACING));
+    }
+
+    IT("exports a valid Chrome trace")
+    {
+        const var trace = JSON::parse(Tracing::getChromeTraceJSON());
+
+        REQUIRE(trace["traceEvents"].isArray());
+    }
+
+#if REAX_ENABLE_TRACING
+    Tracing::clear();
+
+    IT("records the callbacks of a named chain")
+    {
+        PublishSubject<int> subject;
+        auto subscription = subject.named("TracingTest")
+                                .map([](int i) { return i * 2; })
+                                .subscribe([](int) {});
+
+        subject.onNext(1);
+
+        const auto names = getEventNames();
+        REQUIRE(names.contains("TracingTest/map"));
+    }
+
+    IT("records values that are enqueued into and emitted from a LockFreeSource")
+    {
+        LockFreeSource<int> source(4, ProducerPolicy::SingleProducer);
+        Array<int> values;
+        auto subscription = source.subscribe([&](int i) { values.add(i); });
+
+        for (int i = 0; i < 6; ++i)
+            source.onNext(i, CongestionPolicy::DropNewest);
+
+        ReaX_RunDispatchLoopUntil(values.size() == 4);
+
+        const auto names = getEventNames();
+        REQUIRE(names.contains("LockFreeSource::onNext"));
+        REQUIRE(names.contains("LockFreeSource::onNext (dropped)"));
+        REQUIRE(names.contains("LockFreeSource dequeue"));
+        REQUIRE(names.contains("LockFreeSource::handleAsyncUpdate"));
+    }
+
+    IT("reuses the buffers of threads that have exited")
+    {
+        // More threads than there are buffers, but only one at a time
+        for (int i = 0; i < 100; ++i)
+            std::thread([]() { REAX_TRACE_INSTANT("TracingTest thread", -1); }).join();
+
+        std::thread([]() { REAX_TRACE_INSTANT("TracingTest last thread", -1); }).join();
+
+        REQUIRE(getEventNames().contains("TracingTest last thread"));
+    }
+
+    IT("discards the recorded events when clearing")
+    {
+        PublishSubject<int> subject;
+        auto subscription = subject.map([](int i) { return i; }).subscribe([](int) {});
+        subject.onNext(1);
+        REQUIRE(!getEventNames().isEmpty());
+
+        Tracing::clear();
+
+        REQUIRE(getEventNames().isEmpty());
+    }
+#else
+    IT("doesn't record events if tracing is disabled")
+    {
+        LockFreeSource<int> source(4);
+        source.onNext(1, CongestionPolicy::DropNewest);
+
+        REQUIRE(getEventNames().isEmpty());
+    }
+#endif
+}
@@ -1,7 +1,77 @@
 using std::placeholders::_1;
 
+/*
+ Collects the properties that have pending values, and applies them once per frame. Without a frame rate, values are applied immediately (by ComponentExtension::setter, without going through this class).
+ */
+class ComponentExtension::PendingValues : private juce::Timer
+{
+public:
+    void setFrameRate(int newFramesPerSecond)
+    {
+        // The frame rate must be >= 0.
+        jassert(newFramesPerSecond >= 0);
+
+        framesPerSecond = jmax(0, newFramesPerSecond);
+
+        if (framesPerSecond == 0)
+            applyPendingValues();
+        else if (isTimerRunning())
+            startTimerHz(framesPerSecond);
+    }
+
+    bool isApplyingImmediately() const
+    {
+        return framesPerSecond == 0;
+    }
+
+    // The applyValue function applies the latest pushed value of the property
+    void apply(const void* property, const std::shared_ptr<const std::function<void()>>& applyValue)
+    {
+        // The latest value is applied anyway if the property is already pending, keeping the order in which the properties were first pushed
+        for (auto& pendingValue : pendingValues) {
+            if (pendingValue.first == property)
+                return;
+        }
+
+        pendingValues.emplace_back(property, applyValue);
+
+        // The timer only runs while there are pending values
+        if (!isTimerRunning())
+            startTimerHz(framesPerSecond);
+    }
+
+private:
+    typedef std::vector<std::pair<const void*, std::shared_ptr<const std::function<void()>>>> Values;
+
+    int framesPerSecond = 0;
+    Values pendingValues;
+
+    // Reused for each frame, so applying values doesn't allocate a new vector
+    Values valuesToApply;
+
+    void applyPendingValues()
+    {
+        // Applying a value may push new values (e.g. from a Listener), which are applied in the next frame
+        valuesToApply.swap(pendingValues);
+
+        for (auto& value : valuesToApply)
+            (*value.second)();
+
+        valuesToApply.clear();
+
+        if (pendingValues.empty())
+            stopTimer();
+    }
+
+    void timerCallback() override
+    {
+        applyPendingValues();
+    }
+};
+
 ComponentExtension::ComponentExtension(Component& parent)
 : colourSubjects(new std::map<int, PublishSubject<juce::Colour>>()),
+  pendingValues(new PendingValues()),
   parent(parent),
   bounds(parent.getBounds()),
   visible(parent.isVisible()),
@@ -9,12 +79,12 @@ ComponentExtension::ComponentExtension(Component& parent)
 {
     parent.addComponentListener(this);
 
-    bounds.skip(1).subscribe([&parent](const Rectangle<int>& bounds) {
+    bounds.skip(1).subscribe(setter<Rectangle<int>>(&bounds, [&parent](const Rectangle<int>& bounds) {
                       parent.setBounds(bounds);
-                  })
+                  }))
         .disposedBy(*disposeBag);
 
-    visible.skip(1).subscribe(std::bind(&Component::setVisible, &parent, _1)).disposedBy(*disposeBag);
+    visible.skip(1).subscribe(setter<bool>(&visible, std::bind(&Component::setVisible, &parent, _1))).disposedBy(*disposeBag);
 }
 
 ComponentExtension::~ComponentExtension()
@@ -29,12 +99,33 @@ Observer<Colour> ComponentExtension::colour(int colourId) const
         colourSubjects->insert(std::make_pair(colourId, PublishSubject<Colour>()));
 
     // Subscribe
-    colourSubjects->at(colourId).subscribe(std::bind(&Component::setColour, &parent, colourId, _1)).disposedBy(*disposeBag);
+    const PublishSubject<Colour>& subject = colourSubjects->at(colourId);
+    subject.subscribe(setter<Colour>(&subject, std::bind(&Component::setColour, &parent, colourId, _1))).disposedBy(*disposeBag);
 
     // Return as Observer
     return colourSubjects->at(colourId);
 }
 
+void ComponentExtension::applyValuesAtFrameRate(int framesPerSecond) const
+{
+    pendingValues->setFrameRate(framesPerSecond);
+}
+
+void ComponentExtension::applyValuesImmediately() const
+{
+    pendingValues->setFrameRate(0);
+}
+
+bool ComponentExtension::appliesValuesImmediately() const
+{
+    return pendingValues->isApplyingImmediately();
+}
+
+void ComponentExtension::applyValue(const void* property, const std::shared_ptr<const std::function<void()>>& apply) const
+{
+    pendingValues->apply(property, apply);
+}
+
 void ComponentExtension::componentMovedOrResized(Component&, bool, bool)
 {
     if (parent.getBounds() != bounds.getValue())
@@ -53,17 +144,15 @@ ButtonExtension::ButtonExtension(Button& parent)
   clicked(_clicked),
   buttonState(parent.getState()),
   toggleState(parent.getToggleState()),
-  text(_text),
-  tooltip(_tooltip)
+  text(setter<String>(&text, std::bind(&Button::setButtonText, &parent, _1))),
+  tooltip(setter<String>(&tooltip, std::bind(&Button::setTooltip, &parent, _1)))
 {
     parent.addListener(this);
 
-    _text.subscribe(std::bind(&Button::setButtonText, &parent, _1)).disposedBy(disposeBag);
-    _tooltip.subscribe(std::bind(&Button::setTooltip, &parent, _1)).disposedBy(disposeBag);
-    buttonState.skip(1).subscribe(std::bind(&Button::setState, &parent, _1)).disposedBy(disposeBag);
-    toggleState.skip(1).subscribe([&parent](bool toggled) {
+    buttonState.skip(1).subscribe(setter<Button::ButtonState>(&buttonState, std::bind(&Button::setState, &parent, _1))).disposedBy(disposeBag);
+    toggleState.skip(1).subscribe(setter<bool>(&toggleState, [&parent](bool toggled) {
                            parent.setToggleState(toggled, sendNotificationSync);
-                       })
+                       }))
         .disposedBy(disposeBag);
 }
 
@@ -71,6 +160,10 @@ ButtonExtension::~ButtonExtension()
 {
     // The constructor has initialized ComponentExtension() with a Button& parent.
     static_cast<Button&>(parent).removeListener(this);
+
+    // The Observers call into this extension, so stop them in case they are still subscribed to something
+    text.onCompleted();
+    tooltip.onCompleted();
 }
 
 void ButtonExtension::buttonClicked(Button*)
@@ -89,15 +182,17 @@ void ButtonExtension::buttonStateChanged(Button* button)
 
 ImageComponentExtension::ImageComponentExtension(ImageComponent& parent)
 : ComponentExtension(parent),
-  image(_image),
-  imagePlacement(_imagePlacement)
-{
-    _image.subscribe([&parent](const Image& image) {
-              parent.setImage(image);
-          })
-        .disposedBy(disposeBag);
+  image(setter<Image>(&image, [&parent](const Image& image) {
+      parent.setImage(image);
+  })),
+  imagePlacement(setter<RectanglePlacement>(&imagePlacement, std::bind(&ImageComponent::setImagePlacement, &parent, _1)))
+{}
 
-    _imagePlacement.subscribe(std::bind(&ImageComponent::setImagePlacement, &parent, _1)).disposedBy(disposeBag);
+ImageComponentExtension::~ImageComponentExtension()
+{
+    // The Observers call into this extension, so stop them in case they are still subscribed to something
+    image.onCompleted();
+    imagePlacement.onCompleted();
 }
 
 LabelExtension::LabelExtension(Label& parent)
@@ -107,66 +202,44 @@ LabelExtension::LabelExtension(Label& parent)
   text(parent.getText()),
   showEditor(parent.getCurrentTextEditor() != nullptr),
   discardChangesWhenHidingEditor(_discardChangesWhenHidingEditor),
-  font(_font),
-  justificationType(_justificationType),
-  borderSize(_borderSize),
-  attachedComponent(_attachedComponent),
-  attachedOnLeft(_attachedOnLeft),
-  minimumHorizontalScale(_minimumHorizontalScale),
-  keyboardType(_keyboardType),
-  editableOnSingleClick(_editableOnSingleClick),
-  editableOnDoubleClick(_editableOnDoubleClick),
-  lossOfFocusDiscardsChanges(_lossOfFocusDiscardsChanges),
+  font(setter<Font>(&font, std::bind(&Label::setFont, &parent, _1))),
+  justificationType(setter<Justification>(&justificationType, std::bind(&Label::setJustificationType, &parent, _1))),
+  borderSize(setter<BorderSize<int>>(&borderSize, std::bind(&Label::setBorderSize, &parent, _1))),
+  attachedComponent(setter<WeakReference<Component>>(&attachedComponent, [&parent](const WeakReference<Component>& component) {
+      parent.attachToComponent(component, parent.isAttachedOnLeft());
+  })),
+  attachedOnLeft(setter<bool>(&attachedOnLeft, [&parent](bool attachedOnLeft) {
+      parent.attachToComponent(parent.getAttachedComponent(), attachedOnLeft);
+  })),
+  minimumHorizontalScale(setter<float>(&minimumHorizontalScale, std::bind(&Label::setMinimumHorizontalScale, &parent, _1))),
+  keyboardType(setter<TextInputTarget::VirtualKeyboardType>(&keyboardType, [&parent](TextInputTarget::VirtualKeyboardType keyboardType) {
+      parent.setKeyboardType(keyboardType);
+
+      if (auto editor = parent.getCurrentTextEditor())
+          editor->setKeyboardType(keyboardType);
+  })),
+  // Cannot use combineLatest for these, because changing something on the Label directly doesn't update the Observers
+  editableOnSingleClick(setter<bool>(&editableOnSingleClick, [&parent](bool editableOnSingleClick) {
+      parent.setEditable(editableOnSingleClick, parent.isEditableOnDoubleClick(), parent.doesLossOfFocusDiscardChanges());
+  })),
+  editableOnDoubleClick(setter<bool>(&editableOnDoubleClick, [&parent](bool editableOnDoubleClick) {
+      parent.setEditable(parent.isEditableOnSingleClick(), editableOnDoubleClick, parent.doesLossOfFocusDiscardChanges());
+  })),
+  lossOfFocusDiscardsChanges(setter<bool>(&lossOfFocusDiscardsChanges, [&parent](bool lossOfFocusDiscardsChanges) {
+      parent.setEditable(parent.isEditableOnSingleClick(), parent.isEditableOnDoubleClick(), lossOfFocusDiscardsChanges);
+  })),
   textEditor(_textEditor.distinctUntilChanged())
 {
     parent.addListener(this);
 
-    text.skip(1).subscribe(std::bind(&Label::setText, &parent, _1, sendNotificationSync)).disposedBy(disposeBag);
-
-    showEditor.skip(1).withLatestFrom(_discardChangesWhenHidingEditor).subscribe([&parent](const std::tuple<bool, bool>& tuple) {
-                                                                          if (std::get<0>(tuple))
-                                                                              parent.showEditor();
-                                                                          else
-                                                                              parent.hideEditor(std::get<1>(tuple));
-                                                                      })
-        .disposedBy(disposeBag);
-
-    _font.subscribe(std::bind(&Label::setFont, &parent, _1)).disposedBy(disposeBag);
-    _justificationType.subscribe(std::bind(&Label::setJustificationType, &parent, _1)).disposedBy(disposeBag);
-    _borderSize.subscribe(std::bind(&Label::setBorderSize, &parent, _1)).disposedBy(disposeBag);
-
-    _attachedComponent.subscribe([&parent](const WeakReference<Component>& component) {
-                          parent.attachToComponent(component, parent.isAttachedOnLeft());
-                      })
-        .disposedBy(disposeBag);
-
-    _attachedOnLeft.subscribe([&parent](bool attachedOnLeft) {
-                       parent.attachToComponent(parent.getAttachedComponent(), attachedOnLeft);
-                   })
-        .disposedBy(disposeBag);
-
-    _minimumHorizontalScale.subscribe(std::bind(&Label::setMinimumHorizontalScale, &parent, _1)).disposedBy(disposeBag);
-
-    _keyboardType.subscribe([&parent](TextInputTarget::VirtualKeyboardType keyboardType) {
-                     parent.setKeyboardType(keyboardType);
-
-                     if (auto editor = parent.getCurrentTextEditor())
-                         editor->setKeyboardType(keyboardType);
-                 })
-        .disposedBy(disposeBag);
+    text.skip(1).subscribe(setter<String>(&text, std::bind(&Label::setText, &parent, _1, sendNotificationSync))).disposedBy(disposeBag);
 
-    // Cannot use combineLatest for these, because changing something on the Slider directly doesn't update the subject
-    _editableOnSingleClick.subscribe([&parent](bool editableOnSingleClick) {
-                              parent.setEditable(editableOnSingleClick, parent.isEditableOnDoubleClick(), parent.doesLossOfFocusDiscardChanges());
-                          })
-        .disposedBy(disposeBag);
-    _editableOnDoubleClick.subscribe([&parent](bool editableOnDoubleClick) {
-                              parent.setEditable(parent.isEditableOnSingleClick(), editableOnDoubleClick, parent.doesLossOfFocusDiscardChanges());
-                          })
-        .disposedBy(disposeBag);
-    _lossOfFocusDiscardsChanges.subscribe([&parent](bool lossOfFocusDiscardsChanges) {
-                                   parent.setEditable(parent.isEditableOnSingleClick(), parent.isEditableOnDoubleClick(), lossOfFocusDiscardsChanges);
-                               })
+    showEditor.skip(1).subscribe(setter<bool>(&showEditor, [this, &parent](bool show) {
+                          if (show)
+                              parent.showEditor();
+                          else
+                              parent.hideEditor(_discardChangesWhenHidingEditor.getValue());
+                      }))
         .disposedBy(disposeBag);
 }
 
@@ -174,6 +247,18 @@ LabelExtension::~LabelExtension()
 {
     // The constructor has initialized ComponentExtension() with a Label& parent.
     static_cast<Label&>(parent).removeListener(this);
+
+    // The Observers call into this extension, so stop them in case they are still subscribed to something
+    font.onCompleted();
+    justificationType.onCompleted();
+    borderSize.onCompleted();
+    attachedComponent.onCompleted();
+    attachedOnLeft.onCompleted();
+    minimumHorizontalScale.onCompleted();
+    keyboardType.onCompleted();
+    editableOnSingleClick.onCompleted();
+    editableOnDoubleClick.onCompleted();
+    lossOfFocusDiscardsChanges.onCompleted();
 }
 
 void LabelExtension::labelTextChanged(Label* parent)
@@ -206,74 +291,66 @@ SliderExtension::SliderExtension(juce::Slider& parent,
   _dragging(false),
   _discardChangesWhenHidingTextBox(false),
   value(parent.getValue()),
-  minimum(_minimum),
-  maximum(_maximum),
+  // Cannot use combineLatest for these, because changing something on the Slider directly doesn't update the Observers
+  minimum(setter<double>(&minimum, [&parent](double minimum) {
+      parent.setRange(minimum, parent.getMaximum(), parent.getInterval());
+  })),
+  maximum(setter<double>(&maximum, [&parent](double maximum) {
+      parent.setRange(parent.getMinimum(), maximum, parent.getInterval());
+  })),
   minValue(hasMultipleThumbs(parent) ? parent.getMinValue() : parent.getValue()),
   maxValue(hasMultipleThumbs(parent) ? parent.getMaxValue() : parent.getValue()),
-  doubleClickReturnValue(_doubleClickReturnValue),
-  interval(_interval),
-  skewFactorMidPoint(_skewFactorMidPoint),
+  doubleClickReturnValue(setter<double>(&doubleClickReturnValue, [&parent](double value) {
+      parent.setDoubleClickReturnValue(value != DBL_MAX, value);
+  })),
+  interval(setter<double>(&interval, [&parent](double interval) {
+      parent.setRange(parent.getMinimum(), parent.getMaximum(), interval);
+  })),
+  skewFactorMidPoint(setter<double>(&skewFactorMidPoint, std::bind(&Slider::setSkewFactorFromMidPoint, &parent, _1))),
   dragging(_dragging.distinctUntilChanged()),
   thumbBeingDragged(dragging.map([&parent](bool) { return parent.getThumbBeingDragged(); })),
-  showTextBox(_showTextBox),
-  textBoxIsEditable(_textBoxIsEditable),
+  showTextBox(setter<bool>(&showTextBox, [this, &parent](bool show) {
+      if (show)
+          parent.showTextBox();
+      else
+          parent.hideTextBox(_discardChangesWhenHidingTextBox.getValue());
+  })),
+  textBoxIsEditable(setter<bool>(&textBoxIsEditable, std::bind(&Slider::setTextBoxIsEditable, &parent, _1))),
   discardChangesWhenHidingTextBox(_discardChangesWhenHidingTextBox),
   getValueFromText(getValueFromText),
   getTextFromValue(getTextFromValue)
 {
     parent.addListener(this);
 
-    value.skip(1).subscribe([&parent](double value) {
+    value.skip(1).subscribe(setter<double>(&value, [&parent](double value) {
                      parent.setValue(value, sendNotificationSync);
-                 })
-        .disposedBy(disposeBag);
-
-    // Cannot use combineLatest for these, because changing something on the Slider directly doesn't update the subject
-    _minimum.subscribe([&parent](double minimum) {
-                parent.setRange(minimum, parent.getMaximum(), parent.getInterval());
-            })
-        .disposedBy(disposeBag);
-    _maximum.subscribe([&parent](double maximum) {
-                parent.setRange(parent.getMinimum(), maximum, parent.getInterval());
-            })
-        .disposedBy(disposeBag);
-    _interval.subscribe([&parent](double interval) {
-                 parent.setRange(parent.getMinimum(), parent.getMaximum(), interval);
-             })
+                 }))
         .disposedBy(disposeBag);
 
-    minValue.skip(1).subscribe([&parent](double minValue) {
+    minValue.skip(1).subscribe(setter<double>(&minValue, [&parent](double minValue) {
                         parent.setMinValue(minValue, sendNotificationSync, true);
-                    })
+                    }))
         .disposedBy(disposeBag);
 
-    maxValue.skip(1).subscribe([&parent](double maxValue) {
+    maxValue.skip(1).subscribe(setter<double>(&maxValue, [&parent](double maxValue) {
                         parent.setMaxValue(maxValue, sendNotificationSync, true);
-                    })
+                    }))
         .disposedBy(disposeBag);
-
-    _doubleClickReturnValue.subscribe([&parent](double value) {
-                               parent.setDoubleClickReturnValue(value != DBL_MAX, value);
-                           })
-        .disposedBy(disposeBag);
-
-    _skewFactorMidPoint.subscribe(std::bind(&Slider::setSkewFactorFromMidPoint, &parent, _1)).disposedBy(disposeBag);
-
-    _showTextBox.withLatestFrom(_discardChangesWhenHidingTextBox).subscribe([&parent](const std::tuple<bool, bool>& tuple) {
-                                                                     if (std::get<0>(tuple))
-                                                                         parent.showTextBox();
-                                                                     else
-                                                                         parent.hideTextBox(std::get<1>(tuple));
-                                                                 })
-        .disposedBy(disposeBag);
-
-    _textBoxIsEditable.subscribe(std::bind(&Slider::setTextBoxIsEditable, &parent, _1)).disposedBy(disposeBag);
 }
 
 SliderExtension::~SliderExtension()
 {
     // The constructor has initialized ComponentExtension() with a Slider& parent.
     static_cast<Slider&>(parent).removeListener(this);
+
+    // The Observers call into this extension, so stop them in case they are still subscribed to something
+    minimum.onCompleted();
+    maximum.onCompleted();
+    doubleClickReturnValue.onCompleted();
+    interval.onCompleted();
+    skewFactorMidPoint.onCompleted();
+    showTextBox.onCompleted();
+    textBoxIsEditable.onCompleted();
 }
 
 void SliderExtension::sliderValueChanged(Slider* slider)
@@ -4,14 +4,42 @@
  Adds reactive extensions to a `juce::Component`.
  
  If you use this directly (instead of `Reactive<Component>`), you **must** ensure that the `Component` has a longer lifetime than this `ComponentExtension`!
+ 
+ Properties of the extensions that only receive values (e.g. `LabelExtension::font`) are plain Observers that call the `Component` directly. Properties that also emit values (e.g. `bounds`) are `BehaviorSubject`s, which are created together with the extension.
  */
 class ComponentExtension : private juce::ComponentListener, private juce::MouseListener
 {
+    class PendingValues;
+
     const std::unique_ptr<std::map<int, PublishSubject<juce::Colour>>> colourSubjects;
+    const std::unique_ptr<PendingValues> pendingValues;
     
 protected:
     /// \cond internal
     juce::Component& parent;
+
+    // Returns a function that sets a property of the parent to a pushed value. The property is identified by an address, e.g. of the Subject that receives the values.
+    template<typename T, typename Setter>
+    std::function<void(const T&)> setter(const void* property, const Setter& set) const
+    {
+        // With a frame rate, the latest pushed value waits in this slot until it's applied. It's reused for each value, so only the first one allocates memory.
+        const auto pendingValue = std::make_shared<std::unique_ptr<T>>();
+        const auto apply = std::make_shared<const std::function<void()>>([pendingValue, set]() { set(**pendingValue); });
+
+        return [this, property, set, pendingValue, apply](const T& value) {
+            if (appliesValuesImmediately()) {
+                set(value);
+                return;
+            }
+
+            if (*pendingValue)
+                **pendingValue = value;
+            else
+                pendingValue->reset(new T(value));
+
+            applyValue(property, apply);
+        };
+    }
     /// \endcond
 
 public:
@@ -29,9 +57,24 @@ public:
     /// Returns an Observer that controls the colour for the given colourId.
     Observer<juce::Colour> colour(int colourId) const;
 
+    /**
+     Applies values that are pushed to this extension (e.g. to `bounds` or `colour()`) once per frame, instead of immediately.
+     
+     If several values are pushed to the same property within a frame, only the latest one is applied. So if an Observable emits values faster than the display can show them, the `Component` isn't laid out and repainted for each value. This also applies to the properties of derived extensions, like `LabelExtension::text`.
+     
+     Subjects like `bounds` still emit each pushed value immediately, even though it's applied to the `Component` later. Must be called on the message thread.
+     */
+    void applyValuesAtFrameRate(int framesPerSecond = 60) const;
+
+    /// Applies each pushed value immediately. This is the default. Values that haven't been applied yet are applied now.
+    void applyValuesImmediately() const;
+
 private:
     const std::unique_ptr<DisposeBag> disposeBag;
 
+    bool appliesValuesImmediately() const;
+    void applyValue(const void* property, const std::shared_ptr<const std::function<void()>>& apply) const;
+
     // Overrides
     void componentMovedOrResized(juce::Component&, bool, bool) override;
     void componentVisibilityChanged(juce::Component&) override;
@@ -47,8 +90,6 @@ private:
 class ButtonExtension : public ComponentExtension, private juce::Button::Listener
 {
     const PublishSubject<Empty> _clicked;
-    const PublishSubject<juce::String> _text;
-    const PublishSubject<juce::String> _tooltip;
 
 public:
     /// Creates a new instance for a given `Button`.
@@ -87,13 +128,12 @@ private:
  */
 class ImageComponentExtension : public ComponentExtension
 {
-    const PublishSubject<juce::Image> _image;
-    const PublishSubject<juce::RectanglePlacement> _imagePlacement;
-
 public:
     /// Creates a new instance for a given `ImageComponent`.
     ImageComponentExtension(juce::ImageComponent& parent);
 
+    ~ImageComponentExtension();
+
     /// Controls the displayed image.
     const Observer<juce::Image> image;
 
@@ -101,8 +141,6 @@ public:
     const Observer<juce::RectanglePlacement> imagePlacement;
 
 private:
-    DisposeBag disposeBag;
-    
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ImageComponentExtension)
 };
 
@@ -114,16 +152,6 @@ private:
 class LabelExtension : public ComponentExtension, private juce::Label::Listener
 {
     const BehaviorSubject<bool> _discardChangesWhenHidingEditor;
-    const PublishSubject<juce::Font> _font;
-    const PublishSubject<juce::Justification> _justificationType;
-    const PublishSubject<juce::BorderSize<int>> _borderSize;
-    const PublishSubject<juce::WeakReference<juce::Component>> _attachedComponent;
-    const PublishSubject<bool> _attachedOnLeft;
-    const PublishSubject<float> _minimumHorizontalScale;
-    const PublishSubject<juce::TextInputTarget::VirtualKeyboardType> _keyboardType;
-    const PublishSubject<bool> _editableOnSingleClick;
-    const PublishSubject<bool> _editableOnDoubleClick;
-    const PublishSubject<bool> _lossOfFocusDiscardsChanges;
     const BehaviorSubject<juce::WeakReference<juce::Component>> _textEditor;
 
 public:
@@ -192,15 +220,8 @@ private:
  */
 class SliderExtension : public ComponentExtension, private juce::Slider::Listener
 {
-    PublishSubject<double> _minimum;
-    PublishSubject<double> _maximum;
-    PublishSubject<double> _doubleClickReturnValue;
-    PublishSubject<double> _interval;
-    PublishSubject<double> _skewFactorMidPoint;
     BehaviorSubject<bool> _dragging;
     BehaviorSubject<bool> _discardChangesWhenHidingTextBox;
-    PublishSubject<bool> _showTextBox;
-    PublishSubject<bool> _textBoxIsEditable;
 
 public:
     /// Creates a new instance for a given `Slider`.
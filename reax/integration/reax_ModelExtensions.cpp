@@ -39,9 +39,108 @@ void AudioProcessorExtension::audioProcessorChanged(AudioProcessor*)
     _processorChanged.onNext(Empty(), CongestionPolicy::DropNewest);
 }
 
-struct AudioProcessorValueTreeStateExtension::Impl
+struct AudioProcessorValueTreeStateExtension::Impl : private Timer
 {
-    std::map<String, Reactive<Value>> parameterValues;
+    // Keeps rawValue up to date, on whichever thread the parameter is changed
+    class Parameter : private AudioProcessorValueTreeState::Listener
+    {
+    public:
+        Parameter(AudioProcessorValueTreeState& state, StringRef parameterID, std::atomic<bool>& anyParameterChanged)
+        : state(state),
+          parameterID(parameterID),
+          anyParameterChanged(anyParameterChanged)
+        {
+            // Store the initial value before adding the listener, so it can't overwrite a newer value from the listener
+            const auto rawParameterValue = state.getRawParameterValue(parameterID);
+            float initialValue = (rawParameterValue ? static_cast<float>(*rawParameterValue) : 0.f);
+            rawValue.store(initialValue, std::memory_order_relaxed);
+
+            state.addParameterListener(parameterID, this);
+
+            // The parameter may have changed before the listener was added. Read it again, unless the listener has already stored a value.
+            if (rawParameterValue)
+                rawValue.compare_exchange_strong(initialValue, *rawParameterValue, std::memory_order_relaxed);
+        }
+
+        ~Parameter()
+        {
+            state.removeParameterListener(parameterID, this);
+        }
+
+        std::atomic<float> rawValue{ 0 };
+
+        // Created on the message thread when parameterValue is first called for this parameter
+        std::unique_ptr<Reactive<Value>> reactiveValue;
+
+        Reactive<Value>& getReactiveValue()
+        {
+            if (!reactiveValue)
+                reactiveValue.reset(new Reactive<Value>(state.getParameterAsValue(parameterID)));
+
+            return *reactiveValue;
+        }
+
+        // Created on the message thread when rawParameterValues is first called for this parameter
+        std::unique_ptr<BehaviorSubject<float>> rawValues;
+
+        // Emits the latest rawValue, if it has changed since the last call. Called on the message thread.
+        void emitRawValueIfChanged()
+        {
+            if (!rawValues || !hasChanged.exchange(false, std::memory_order_acq_rel))
+                return;
+
+            const float latestValue = rawValue.load(std::memory_order_relaxed);
+            if (latestValue != rawValues->getValue())
+                rawValues->onNext(latestValue);
+        }
+
+    private:
+        AudioProcessorValueTreeState& state;
+        const String parameterID;
+        std::atomic<bool>& anyParameterChanged;
+        std::atomic<bool> hasChanged{ false };
+
+        void parameterChanged(const String&, float newValue) override
+        {
+            rawValue.store(newValue, std::memory_order_relaxed);
+
+            // Set anyParameterChanged last, so the message thread sees hasChanged when it sees anyParameterChanged
+            hasChanged.store(true, std::memory_order_release);
+            anyParameterChanged.store(true, std::memory_order_release);
+        }
+    };
+
+    static const int FramesPerSecond = 60;
+
+    // Indexed by ParameterHandle::index
+    std::vector<std::unique_ptr<Parameter>> parameters;
+
+    // Only used to resolve parameter IDs to handles
+    std::map<String, size_t> indices;
+
+    // Set by any parameter that has changed, so timerCallback doesn't have to check each parameter on every frame
+    std::atomic<bool> anyParameterChanged{ false };
+
+    ~Impl()
+    {
+        stopTimer();
+    }
+
+    void startEmittingRawValues()
+    {
+        if (!isTimerRunning())
+            startTimerHz(FramesPerSecond);
+    }
+
+private:
+    void timerCallback() override
+    {
+        if (!anyParameterChanged.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        for (auto& parameter : parameters)
+            parameter->emitRawValueIfChanged();
+    }
 };
 
 AudioProcessorValueTreeStateExtension::AudioProcessorValueTreeStateExtension(AudioProcessorValueTreeState& parent)
@@ -53,9 +152,36 @@ AudioProcessorValueTreeStateExtension::~AudioProcessorValueTreeStateExtension()
 
 BehaviorSubject<var> AudioProcessorValueTreeStateExtension::parameterValue(StringRef parameterID) const
 {
-    // Create a Reactive<Value> for the parameter, if not already done
-    if (impl->parameterValues.find(parameterID) == impl->parameterValues.end())
-        impl->parameterValues.emplace(parameterID, parent.getParameterAsValue(parameterID));
+    return parameterValue(parameterHandle(parameterID));
+}
+
+AudioProcessorValueTreeStateExtension::ParameterHandle AudioProcessorValueTreeStateExtension::parameterHandle(StringRef parameterID) const
+{
+    // Create a Parameter if not already done. This does only a single lookup.
+    const auto inserted = impl->indices.emplace(String(parameterID), impl->parameters.size());
+    if (inserted.second)
+        impl->parameters.emplace_back(new Impl::Parameter(parent, parameterID, impl->anyParameterChanged));
+
+    const size_t index = inserted.first->second;
+    return ParameterHandle(index, &impl->parameters[index]->rawValue);
+}
+
+BehaviorSubject<var> AudioProcessorValueTreeStateExtension::parameterValue(const ParameterHandle& handle) const
+{
+    jassert(handle.isValid() && handle.index < impl->parameters.size());
+
+    return impl->parameters[handle.index]->getReactiveValue().rx.subject;
+}
+
+Observable<float> AudioProcessorValueTreeStateExtension::rawParameterValues(const ParameterHandle& handle) const
+{
+    jassert(handle.isValid() && handle.index < impl->parameters.size());
+
+    auto& parameter = *impl->parameters[handle.index];
+    if (!parameter.rawValues)
+        parameter.rawValues.reset(new BehaviorSubject<float>(parameter.rawValue.load(std::memory_order_relaxed)));
+
+    impl->startEmittingRawValues();
 
-    return impl->parameterValues.at(parameterID).rx.subject;
+    return *parameter.rawValues;
 }
@@ -61,6 +61,32 @@ private:
  */
 class AudioProcessorValueTreeStateExtension {
 public:
+    /**
+     Refers to a parameter of the `AudioProcessorValueTreeState`. Get one by calling AudioProcessorValueTreeStateExtension::parameterHandle.
+
+     A handle resolves the parameter ID once, so accessing the parameter through it doesn't need any string comparisons. It's only valid for the `AudioProcessorValueTreeStateExtension` that created it.
+     */
+    class ParameterHandle
+    {
+    public:
+        /// Creates an invalid handle, which doesn't refer to any parameter.
+        ParameterHandle() = default;
+
+        /// Returns true if this handle refers to a parameter.
+        bool isValid() const noexcept { return (rawValue != nullptr); }
+
+    private:
+        friend class AudioProcessorValueTreeStateExtension;
+
+        ParameterHandle(size_t index, const std::atomic<float>* rawValue)
+        : index(index),
+          rawValue(rawValue)
+        {}
+
+        size_t index = 0;
+        const std::atomic<float>* rawValue = nullptr;
+    };
+
     /// Creates a new instance for a given `AudioProcessorValueTreeState`.
     AudioProcessorValueTreeStateExtension(juce::AudioProcessorValueTreeState& parent);
     
@@ -74,6 +100,42 @@ public:
      Parameter values can be changed from the audio thread; in this case the subject's `Observable` side emits asynchronously.
      */
     BehaviorSubject<juce::var> parameterValue(const juce::StringRef parameterID) const;
+
+    /**
+     Returns a handle for the parameter with the given ID. Call this once (e.g. when constructing your editor) and keep the handle, to access the parameter without looking up its ID again.
+
+     Must be called on the message thread.
+     */
+    ParameterHandle parameterHandle(const juce::StringRef parameterID) const;
+
+    /**
+     Returns a subject to control the value of the parameter that the handle refers to. Same as `parameterValue(parameterID)`, but without looking up the parameter ID.
+
+     Must be called on the message thread.
+     */
+    BehaviorSubject<juce::var> parameterValue(const ParameterHandle& handle) const;
+
+    /**
+     Returns the latest value of the parameter that the handle refers to, in the parameter's range (not normalised).
+
+     Unlike the subject returned by `parameterValue`, this doesn't go through a `juce::Value`, so it's up to date immediately after the parameter has changed (even if it was changed on another thread). It's wait-free and can be called from any thread, e.g. the audio thread.
+
+     The handle must be valid.
+     */
+    float rawParameterValue(const ParameterHandle& handle) const noexcept
+    {
+        jassert(handle.isValid());
+        return handle.rawValue->load(std::memory_order_relaxed);
+    }
+
+    /**
+     Returns an Observable that emits the raw value of the parameter that the handle refers to (in the parameter's range, not normalised). It emits the current value when you subscribe, and then each change.
+
+     Changes don't go through the `AudioProcessorValueTreeState`'s `ValueTree` or a `juce::Value`. They are picked up directly from the parameter (e.g. when the host automates it on the audio thread) and emitted on the message thread, at most once per frame. If a parameter changes several times within a frame, only its latest value is emitted. So this is cheaper than `parameterValue` if you only need to observe the parameter (e.g. to update a GUI), especially with many automated parameters.
+
+     Must be called on the message thread. The handle must be valid.
+     */
+    Observable<float> rawParameterValues(const ParameterHandle& handle) const;
     
 private:
     struct Impl;
@@ -13,6 +13,9 @@ using namespace juce;
 #include "integration/reax_ReactiveModel.cpp"
 
 #include "util/internal/reax_any.cpp"
+#include "util/internal/reax_LockFreeSourceStatisticsRecorder.cpp"
+#include "util/reax_Tracing.cpp"
+#include "util/reax_ScopedRealtimeThread.cpp"
 }
 
 #pragma clang diagnostic pop
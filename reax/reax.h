@@ -24,13 +24,23 @@ END_JUCE_MODULE_DECLARATION
 #include <juce_graphics/juce_graphics.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include "util/internal/reax_Config.h"
+
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <cstring>
+#include <deque>
 #include <exception>
 #include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <set>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <typeinfo>
@@ -46,17 +56,31 @@ namespace reax {
 /// Used for Observables that don't emit a meaningful value, and just notify that something has changed.
 typedef std::tuple<> Empty;
 
+#include "util/internal/reax_RealtimeCheck.h"
 #include "util/internal/reax_any.h"
+#include "util/internal/reax_TraceBuffer.h"
 #include "rx/reax_Subscription.h"
 #include "rx/reax_DisposeBag.h"
 #include "rx/internal/reax_Observer_Impl.h"
 #include "rx/reax_Observer.h"
 #include "rx/reax_Scheduler.h"
+#include "rx/reax_Instrumentation.h"
+#include "rx/internal/reax_Instrumentation_Impl.h"
 #include "rx/internal/reax_Observable_Impl.h"
 #include "rx/reax_Observable.h"
+#include "rx/internal/reax_TypedObservable_Impl.h"
+#include "rx/reax_TypedObservable.h"
 #include "rx/internal/reax_Subjects_Impl.h"
 #include "rx/reax_Subjects.h"
 
+#include "util/reax_BlockView.h"
+#include "util/internal/reax_BlockPool.h"
+#include "util/internal/reax_CacheLinePadded.h"
+#include "util/internal/reax_SingleProducerQueue.h"
+#include "util/reax_Tracing.h"
+#include "util/reax_ScopedRealtimeThread.h"
+#include "util/reax_LockFreeSourceStatistics.h"
+#include "util/internal/reax_LockFreeSourceStatisticsRecorder.h"
 #include "util/reax_LockFreeSource.h"
 #include "util/reax_LockFreeTarget.h"
 
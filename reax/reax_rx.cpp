@@ -6,6 +6,8 @@
 #include "RxCpp/Rx/v2/src/rxcpp/rx.hpp"
 #pragma clang diagnostic pop
 
+#include "util/internal/reax_Config.h"
+
 // Enable stricter warnings
 #include "util/internal/reax_ExtraWarnings.h"
 #pragma clang diagnostic push
@@ -14,9 +16,13 @@ REAX_ENABLE_EXTRA_WARNINGS
 namespace reax {
 using namespace juce;
 
+#include "util/internal/reax_RealtimeCheck.h"
 #include "util/internal/reax_any.h"
+#include "util/internal/reax_TraceBuffer.h"
     
 #include "rx/reax_Subscription.h"
+#include "rx/reax_Instrumentation.h"
+#include "rx/internal/reax_Instrumentation_Impl.h"
 #include "rx/internal/reax_Observable_Impl.h"
 #include "rx/reax_Scheduler.h"
 #include "rx/internal/reax_Observer_Impl.h"
@@ -26,6 +32,7 @@ using namespace juce;
 #include "rx/reax_Subscription.cpp"
 #include "rx/reax_DisposeBag.cpp"
 #include "rx/reax_Scheduler.cpp"
+#include "rx/reax_Instrumentation.cpp"
 #include "rx/internal/reax_Scheduler_Impl.cpp"
 #include "rx/internal/reax_Observable_Impl.cpp"
 #include "rx/internal/reax_Observer_Impl.cpp"
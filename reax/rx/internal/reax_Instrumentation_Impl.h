@@ -0,0 +1,38 @@
+#pragma once
+
+#if REAX_ENABLE_INSTRUMENTATION
+namespace detail {
+// The counters of all operators with the same name. They are updated on whichever thread the operators run.
+struct OperatorCounters
+{
+    std::atomic<juce::int64> numValuesIn{ 0 };
+    std::atomic<juce::int64> numValuesOut{ 0 };
+    std::atomic<juce::int64> callbackTicks{ 0 };
+    std::atomic<int> numSubscribers{ 0 };
+};
+
+// Returns the counters for the operator with the given name (e.g. "meterChain/map"). The counters are kept until the app exits.
+std::shared_ptr<OperatorCounters> getOperatorCounters(const juce::String& name);
+
+// Adds the time between its construction and destruction to the callback time of an operator
+class ScopedCallbackTimer
+{
+public:
+    explicit ScopedCallbackTimer(OperatorCounters& counters)
+    : counters(counters),
+      startTicks(juce::Time::getHighResolutionTicks())
+    {}
+
+    ~ScopedCallbackTimer()
+    {
+        counters.callbackTicks.fetch_add(juce::Time::getHighResolutionTicks() - startTicks, std::memory_order_relaxed);
+    }
+
+private:
+    OperatorCounters& counters;
+    const juce::int64 startTicks;
+
+    JUCE_DECLARE_NON_COPYABLE(ScopedCallbackTimer)
+};
+}
+#endif
@@ -72,40 +72,315 @@ rxcpp::observable<any> _range(const T& first, const T& last, unsigned int step)
     return o.map([](const T& value) { return any(value); });
 }
 
-template<typename Function, typename... Os>
-rxcpp::observable<any> _combineLatest(const any& wrapped, Function&& function, Os&&... observables)
+rxcpp::observable<any> _lift(const rxcpp::observable<any>& source, const std::function<detail::ObservableImpl::Transform()>& makeTransform)
+{
+    return source.lift<any>([makeTransform](const rxcpp::subscriber<any>& destination) {
+        // The subscriber may be copied, so the transform (and its state) must be shared between the copies
+        const auto transform = std::make_shared<const detail::ObservableImpl::Transform>(makeTransform());
+
+        return rxcpp::make_subscriber<any>(destination,
+                                           [transform, destination](const any& value) {
+                                               any result(value);
+
+                                               // Like RxCpp's operators, only forward exceptions from the transform to onError. Exceptions thrown by onNext are propagated.
+                                               try {
+                                                   if (!(*transform)(value, result))
+                                                       return;
+                                               }
+                                               catch (...) {
+                                                   destination.on_error(std::current_exception());
+                                                   return;
+                                               }
+
+                                               destination.on_next(std::move(result));
+                                           },
+                                           [destination](std::exception_ptr error) {
+                                               destination.on_error(error);
+                                           },
+                                           [destination]() {
+                                               destination.on_completed();
+                                           });
+    });
+}
+
+String getChainName(const detail::ObservableImpl& observable)
 {
-    return unwrap(wrapped).combine_latest(function, unwrap(observables.wrapped)...);
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+    return observable.name;
+#else
+    ignoreUnused(observable);
+    return String();
+#endif
 }
 
-template<typename... Os>
-rxcpp::observable<any> _concat(const any& wrapped, Os&&... observables)
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+// The name that an operator is recorded under by Instrumentation and Tracing
+String getOperatorName(const String& chainName, const char* operatorName)
 {
-    return unwrap(wrapped).concat(unwrap(observables.wrapped)...);
+    return (chainName.isEmpty() ? String(operatorName) : chainName + "/" + operatorName);
 }
+#endif
 
-template<typename... Os>
-rxcpp::observable<any> _merge(const any& wrapped, Os&&... observables)
+#if REAX_ENABLE_INSTRUMENTATION
+// Increments one of the counters for each value that passes through
+rxcpp::observable<any> countValues(const rxcpp::observable<any>& source, const std::shared_ptr<detail::OperatorCounters>& counters, std::atomic<int64> detail::OperatorCounters::*counter)
 {
-    return unwrap(wrapped).merge(unwrap(observables.wrapped)...);
+    return source.lift<any>([counters, counter](const rxcpp::subscriber<any>& destination) {
+        return rxcpp::make_subscriber<any>(destination,
+                                           [counters, counter, destination](const any& value) {
+                                               ((*counters).*counter).fetch_add(1, std::memory_order_relaxed);
+                                               destination.on_next(value);
+                                           },
+                                           [destination](std::exception_ptr error) {
+                                               destination.on_error(error);
+                                           },
+                                           [destination]() {
+                                               destination.on_completed();
+                                           });
+    });
 }
 
-template<typename... Values>
-rxcpp::observable<any> _startWith(const any& wrapped, Values&&... values)
+// Counts the subscriptions to the source as subscribers of the given operators
+rxcpp::observable<any> countSubscribers(const rxcpp::observable<any>& source, const std::vector<std::shared_ptr<detail::OperatorCounters>>& operators)
 {
-    return unwrap(wrapped).start_with(values...);
+    return rxcpp::observable<>::create<any>([source, operators](const rxcpp::subscriber<any>& destination) {
+        for (auto& counters : operators)
+            counters->numSubscribers.fetch_add(1, std::memory_order_relaxed);
+
+        destination.add([operators]() {
+            for (auto& counters : operators)
+                counters->numSubscribers.fetch_sub(1, std::memory_order_relaxed);
+        });
+
+        source.subscribe(destination);
+    });
 }
+#endif
+
+// Records the counters and trace events of an operator, if instrumentation or tracing is enabled. Otherwise, it passes everything through unchanged.
+class OperatorProbe
+{
+public:
+    OperatorProbe(const String& chainName, const char* operatorName)
+    {
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+        this->chainName = chainName;
+#endif
+#if REAX_ENABLE_INSTRUMENTATION
+        counters = detail::getOperatorCounters(getOperatorName(chainName, operatorName));
+#endif
+#if REAX_ENABLE_TRACING
+        traceName = detail::internTraceName(getOperatorName(chainName, operatorName));
+#endif
+        ignoreUnused(chainName, operatorName);
+    }
+
+    // Unwraps an Observable that the operator receives values from, and counts these values
+    rxcpp::observable<any> input(const any& wrapped) const
+    {
+#if REAX_ENABLE_INSTRUMENTATION
+        return countValues(unwrap(wrapped), counters, &detail::OperatorCounters::numValuesIn);
+#else
+        return unwrap(wrapped);
+#endif
+    }
+
+    // Wraps a function that is passed to the operator, to measure the time spent in it
+    template<typename Result, typename... Args>
+    std::function<Result(Args...)> callback(const std::function<Result(Args...)>& function) const
+    {
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+        const OperatorProbe probe(*this);
+        return [probe, function](Args... args) {
+#if REAX_ENABLE_INSTRUMENTATION
+            const detail::ScopedCallbackTimer timer(*probe.counters);
+#endif
+            REAX_TRACE_SCOPE(probe.traceName);
+            return function(args...);
+        };
+#else
+        return function;
+#endif
+    }
+
+    // Wraps the result of the operator, and counts the values it emits and its subscribers
+    detail::ObservableImpl output(const rxcpp::observable<any>& result) const
+    {
+#if REAX_ENABLE_INSTRUMENTATION
+        detail::ObservableImpl observable(wrap(countSubscribers(countValues(result, counters, &detail::OperatorCounters::numValuesOut), { counters })));
+#else
+        detail::ObservableImpl observable(wrap(result));
+#endif
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+        observable.name = chainName;
+#endif
+        return observable;
+    }
+
+private:
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+    String chainName;
+#endif
+#if REAX_ENABLE_INSTRUMENTATION
+    std::shared_ptr<detail::OperatorCounters> counters;
+#endif
+#if REAX_ENABLE_TRACING
+    const char* traceName = nullptr;
+#endif
+};
 
 template<typename Function, typename... Os>
-rxcpp::observable<any> _withLatestFrom(const any& wrapped, Function&& function, Os&&... observables)
+rxcpp::observable<any> _combineLatest(const OperatorProbe& probe, const any& wrapped, Function&& function, Os&&... observables)
 {
-    return unwrap(wrapped).with_latest_from(function, unwrap(observables.wrapped)...);
+    return probe.input(wrapped).combine_latest(probe.callback(function), probe.input(observables.wrapped)...);
+}
+
+// Converts a buffer from RxCpp's buffer operators to a juce::Array<any>
+any wrapBuffer(const std::vector<any>& values)
+{
+    return any(Array<any>(values.data(), static_cast<int>(values.size())));
+}
+
+// Returns an Observable that emits the first Observable and then the others, to be merged or concatenated
+rxcpp::observable<rxcpp::observable<any>> _observables(const OperatorProbe& probe, const any& first, const Array<ObservableImpl>& others)
+{
+    std::vector<rxcpp::observable<any>> observables;
+    observables.reserve(static_cast<size_t>(others.size() + 1));
+    observables.push_back(probe.input(first));
+    for (auto& other : others)
+        observables.push_back(probe.input(other.wrapped));
+
+    return rxcpp::observable<>::iterate(std::move(observables), rxcpp::identity_immediate());
 }
 
 template<typename Function, typename... Os>
-rxcpp::observable<any> _zip(const any& wrapped, Function&& function, Os&&... observables)
+rxcpp::observable<any> _withLatestFrom(const OperatorProbe& probe, const any& wrapped, Function&& function, Os&&... observables)
+{
+    return probe.input(wrapped).with_latest_from(probe.callback(function), probe.input(observables.wrapped)...);
+}
+
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+// Wraps a Combiner, and passes its values through the probe's callback
+class ProbedCombiner : public detail::ObservableImpl::Combiner
+{
+public:
+    ProbedCombiner(const std::shared_ptr<detail::ObservableImpl::Combiner>& combiner, const OperatorProbe& probe)
+    : combiner(combiner),
+      combine(probe.callback(std::function<bool(size_t, const any&, any&)>([combiner](size_t index, const any& value, any& result) {
+          return combiner->onNext(index, value, result);
+      })))
+    {}
+
+    bool onNext(size_t index, const any& value, any& result) override { return combine(index, value, result); }
+    void onCompleted(size_t index) override { combiner->onCompleted(index); }
+    bool isCompleted() const override { return combiner->isCompleted(); }
+
+private:
+    const std::shared_ptr<detail::ObservableImpl::Combiner> combiner;
+    const std::function<bool(size_t, const any&, any&)> combine;
+};
+#endif
+
+template<typename Function, typename... Os>
+rxcpp::observable<any> _zip(const OperatorProbe& probe, const any& wrapped, Function&& function, Os&&... observables)
+{
+    return probe.input(wrapped).zip(probe.callback(function), probe.input(observables.wrapped)...);
+}
+}
+
+namespace detail {
+
+// A map or filter operator that is fused with the ones before and after it
+struct FusedStage
+{
+    // Set if this is a map operator
+    std::function<any(const any&)> function;
+
+    // Set if this is a filter operator
+    std::function<bool(const any&)> predicate;
+
+#if REAX_ENABLE_INSTRUMENTATION
+    std::shared_ptr<OperatorCounters> counters;
+#endif
+#if REAX_ENABLE_TRACING
+    const char* traceName = nullptr;
+#endif
+};
+
+struct FusedStages
 {
-    return unwrap(wrapped).zip(function, unwrap(observables.wrapped)...);
+    // The Observable that the first stage is applied to
+    rxcpp::observable<any> source;
+
+    std::vector<FusedStage> stages;
+};
+
+}
+
+namespace {
+// Appends a map or filter stage to the stages of an Observable, and applies all stages using a single operator.
+detail::ObservableImpl fuse(const detail::ObservableImpl& observable, detail::FusedStage&& stage)
+{
+    auto fused = std::make_shared<detail::FusedStages>();
+
+    if (observable.fusedStages)
+        *fused = *observable.fusedStages;
+    else
+        fused->source = unwrap(observable.wrapped);
+
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+    const String name = getOperatorName(getChainName(observable), (stage.predicate ? "filter" : "map"));
+#endif
+#if REAX_ENABLE_INSTRUMENTATION
+    stage.counters = detail::getOperatorCounters(name);
+#endif
+#if REAX_ENABLE_TRACING
+    stage.traceName = detail::internTraceName(name);
+#endif
+
+    fused->stages.push_back(std::move(stage));
+
+    const std::shared_ptr<const detail::FusedStages> stages(fused);
+    // The result is initially a copy of the value
+    const detail::ObservableImpl::Transform transform = [stages](const any&, any& result) {
+        for (auto& stage : stages->stages) {
+#if REAX_ENABLE_INSTRUMENTATION
+            stage.counters->numValuesIn.fetch_add(1, std::memory_order_relaxed);
+            const detail::ScopedCallbackTimer timer(*stage.counters);
+#endif
+            REAX_TRACE_SCOPE(stage.traceName);
+
+            if (stage.predicate) {
+                if (!stage.predicate(result))
+                    return false;
+            }
+            else
+                result = stage.function(result);
+
+#if REAX_ENABLE_INSTRUMENTATION
+            stage.counters->numValuesOut.fetch_add(1, std::memory_order_relaxed);
+#endif
+        }
+
+        return true;
+    };
+
+    // The stages are stateless, so all subscriptions can share the same transform
+    rxcpp::observable<any> result = _lift(stages->source, [transform]() { return transform; });
+
+#if REAX_ENABLE_INSTRUMENTATION
+    std::vector<std::shared_ptr<detail::OperatorCounters>> operators;
+    for (auto& fusedStage : stages->stages)
+        operators.push_back(fusedStage.counters);
+
+    result = countSubscribers(result, operators);
+#endif
+
+    detail::ObservableImpl fusedObservable(wrap(result), stages);
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+    fusedObservable.name = observable.name;
+#endif
+    return fusedObservable;
 }
 }
 
@@ -113,8 +388,9 @@ namespace detail {
 
 #pragma mark - Creation
 
-ObservableImpl::ObservableImpl(const any& wrapped)
-: wrapped(wrapped)
+ObservableImpl::ObservableImpl(const any& wrapped, const std::shared_ptr<const FusedStages>& fusedStages)
+: wrapped(wrapped),
+  fusedStages(fusedStages)
 {}
 
 ObservableImpl ObservableImpl::create(const std::function<void(ObserverImpl&&)>& onSubscribe)
@@ -215,54 +491,43 @@ Subscription ObservableImpl::subscribe(const ObserverImpl& observer) const
 
 #pragma mark - Operators
 
-#define REAX_OBSERVABLE_IMPL_UNROLLED_LIST_IMPLEMENTATION(__functionName, __list) \
-    const auto it = __list.begin(); \
-    switch (__list.size()) { \
-        case 1: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, *it)); \
-        case 2: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, *it, *(it + 1))); \
-        case 3: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, *it, *(it + 1), *(it + 2))); \
-        case 4: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, *it, *(it + 1), *(it + 2), *(it + 3))); \
-        case 5: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4))); \
-        case 6: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5))); \
-        case 7: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5), *(it + 6))); \
-        case 8: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5), *(it + 6), *(it + 7))); \
-        default: \
-            jassertfalse; \
-            return any(0); \
-    }
-
 #define REAX_OBSERVABLE_IMPL_UNROLLED_LIST_IMPLEMENTATION_WITH_FUNCTION(__functionName, __list, __function) \
+    const OperatorProbe probe(getChainName(*this), #__functionName); \
     const auto it = __list.begin(); \
     switch (__list.size()) { \
         case 1: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, __function.get<Function2>(), *it)); \
+            return probe.output(JUCE_JOIN_MACRO(_, __functionName)(probe, wrapped, __function.get<Function2>(), *it)); \
         case 2: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, __function.get<Function3>(), *it, *(it + 1))); \
+            return probe.output(JUCE_JOIN_MACRO(_, __functionName)(probe, wrapped, __function.get<Function3>(), *it, *(it + 1))); \
         case 3: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, __function.get<Function4>(), *it, *(it + 1), *(it + 2))); \
+            return probe.output(JUCE_JOIN_MACRO(_, __functionName)(probe, wrapped, __function.get<Function4>(), *it, *(it + 1), *(it + 2))); \
         case 4: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, __function.get<Function5>(), *it, *(it + 1), *(it + 2), *(it + 3))); \
+            return probe.output(JUCE_JOIN_MACRO(_, __functionName)(probe, wrapped, __function.get<Function5>(), *it, *(it + 1), *(it + 2), *(it + 3))); \
         case 5: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, __function.get<Function6>(), *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4))); \
+            return probe.output(JUCE_JOIN_MACRO(_, __functionName)(probe, wrapped, __function.get<Function6>(), *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4))); \
         case 6: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, __function.get<Function7>(), *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5))); \
+            return probe.output(JUCE_JOIN_MACRO(_, __functionName)(probe, wrapped, __function.get<Function7>(), *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5))); \
         case 7: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, __function.get<Function8>(), *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5), *(it + 6))); \
+            return probe.output(JUCE_JOIN_MACRO(_, __functionName)(probe, wrapped, __function.get<Function8>(), *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5), *(it + 6))); \
         case 8: \
-            return wrap(JUCE_JOIN_MACRO(_, __functionName)(wrapped, __function.get<Function9>(), *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5), *(it + 6), *(it + 7))); \
+            return probe.output(JUCE_JOIN_MACRO(_, __functionName)(probe, wrapped, __function.get<Function9>(), *it, *(it + 1), *(it + 2), *(it + 3), *(it + 4), *(it + 5), *(it + 6), *(it + 7))); \
         default: \
             jassertfalse; \
             return any(0); \
     }
 
+ObservableImpl ObservableImpl::bufferCount(unsigned int count) const
+{
+    const OperatorProbe probe(getChainName(*this), "bufferCount");
+    return probe.output(probe.input(wrapped).buffer(count).map(&wrapBuffer));
+}
+
+ObservableImpl ObservableImpl::bufferTime(const juce::RelativeTime& period) const
+{
+    const OperatorProbe probe(getChainName(*this), "bufferTime");
+    return probe.output(probe.input(wrapped).buffer_with_time(durationFromRelativeTime(period)).map(&wrapBuffer));
+}
+
 ObservableImpl ObservableImpl::combineLatest(std::initializer_list<ObservableImpl> others, const any& function) const 
 {
     REAX_OBSERVABLE_IMPL_UNROLLED_LIST_IMPLEMENTATION_WITH_FUNCTION(combineLatest, others, function)
@@ -270,104 +535,130 @@ ObservableImpl ObservableImpl::combineLatest(std::initializer_list<ObservableImp
 
 ObservableImpl ObservableImpl::concat(const Array<ObservableImpl>& others) const
 {
-    REAX_OBSERVABLE_IMPL_UNROLLED_LIST_IMPLEMENTATION(concat, others);
+    const OperatorProbe probe(getChainName(*this), "concat");
+    return probe.output(_observables(probe, wrapped, others).concat());
 }
 
 ObservableImpl ObservableImpl::debounce(const juce::RelativeTime& period) const
 {
-    return wrap(unwrap(wrapped).debounce(durationFromRelativeTime(period)));
+    const OperatorProbe probe(getChainName(*this), "debounce");
+    return probe.output(probe.input(wrapped).debounce(durationFromRelativeTime(period)));
 }
 
 ObservableImpl ObservableImpl::distinctUntilChanged(const std::function<bool(const any&, const any&)>& equals) const
 {
-    return wrap(unwrap(wrapped).distinct_until_changed(equals));
+    const OperatorProbe probe(getChainName(*this), "distinctUntilChanged");
+    return probe.output(probe.input(wrapped).distinct_until_changed(probe.callback(equals)));
 }
 
 ObservableImpl ObservableImpl::elementAt(int index) const
 {
-    return wrap(unwrap(wrapped).element_at(index));
+    const OperatorProbe probe(getChainName(*this), "elementAt");
+    return probe.output(probe.input(wrapped).element_at(index));
 }
 
 ObservableImpl ObservableImpl::filter(const std::function<bool(const any&)>& predicate) const
 {
-    // On Visual Studio, the predicate must be wrapped in a lambda, otherwise RxCpp fails to compile
-    return wrap(unwrap(wrapped).filter([predicate](const any& value) { return predicate(value); }));
+    FusedStage stage;
+    stage.predicate = predicate;
+
+    return fuse(*this, std::move(stage));
 }
 
 ObservableImpl ObservableImpl::flatMap(const std::function<ObservableImpl(const any&)>& f) const
 {
-    return wrap(unwrap(wrapped).flat_map([f](const any& value) {
-        return unwrap(f(value).wrapped);
+    const OperatorProbe probe(getChainName(*this), "flatMap");
+    const auto function = probe.callback(f);
+
+    return probe.output(probe.input(wrapped).flat_map([function](const any& value) {
+        return unwrap(function(value).wrapped);
     }));
 }
 
 ObservableImpl ObservableImpl::map(const std::function<any(const any&)>& function) const
 {
-    return wrap(unwrap(wrapped).map(function));
+    FusedStage stage;
+    stage.function = function;
+
+    return fuse(*this, std::move(stage));
 }
 
 ObservableImpl ObservableImpl::merge(const juce::Array<ObservableImpl>& others) const {
-    REAX_OBSERVABLE_IMPL_UNROLLED_LIST_IMPLEMENTATION(merge, others)
+    const OperatorProbe probe(getChainName(*this), "merge");
+    return probe.output(_observables(probe, wrapped, others).merge());
 }
 
 ObservableImpl ObservableImpl::reduce(const any& startValue, const std::function<any(const any&, const any&)>& f) const
 {
-    return wrap(unwrap(wrapped).reduce(startValue, f));
+    const OperatorProbe probe(getChainName(*this), "reduce");
+    return probe.output(probe.input(wrapped).reduce(startValue, probe.callback(f)));
 }
 
 ObservableImpl ObservableImpl::sample(const juce::RelativeTime& interval) const
 {
-    return wrap(unwrap(wrapped).sample_with_time(durationFromRelativeTime(interval)));
+    const OperatorProbe probe(getChainName(*this), "sample");
+    return probe.output(probe.input(wrapped).sample_with_time(durationFromRelativeTime(interval)));
 }
 
 ObservableImpl ObservableImpl::scan(const any& startValue, const std::function<any(const any&, const any&)>& f) const
 {
-    return wrap(unwrap(wrapped).scan(startValue, f));
+    const OperatorProbe probe(getChainName(*this), "scan");
+    return probe.output(probe.input(wrapped).scan(startValue, probe.callback(f)));
 }
 
 ObservableImpl ObservableImpl::skip(unsigned int numValues) const
 {
-    return wrap(unwrap(wrapped).skip(numValues));
+    const OperatorProbe probe(getChainName(*this), "skip");
+    return probe.output(probe.input(wrapped).skip(numValues));
 }
 
 ObservableImpl ObservableImpl::skipUntil(const ObservableImpl& other) const
 {
-    return wrap(unwrap(wrapped).skip_until(unwrap(other.wrapped)));
+    const OperatorProbe probe(getChainName(*this), "skipUntil");
+    return probe.output(probe.input(wrapped).skip_until(unwrap(other.wrapped)));
 }
 
 ObservableImpl ObservableImpl::startWith(juce::Array<any>&& values) const
 {
-    REAX_OBSERVABLE_IMPL_UNROLLED_LIST_IMPLEMENTATION(startWith, values);
+    const OperatorProbe probe(getChainName(*this), "startWith");
+    return probe.output(rxcpp::observable<>::iterate(std::move(values), rxcpp::identity_immediate()).concat(probe.input(wrapped)));
 }
 
 ObservableImpl ObservableImpl::switchOnNext() const
 {
-    rxcpp::observable<rxcpp::observable<any>> unwrapped = unwrap(wrapped).map([](const any& observable) {
+    const OperatorProbe probe(getChainName(*this), "switchOnNext");
+    rxcpp::observable<rxcpp::observable<any>> unwrapped = probe.input(wrapped).map([](const any& observable) {
         return unwrap(observable.get<ObservableImpl>().wrapped);
     });
 
-    return wrap(unwrapped.switch_on_next());
+    return probe.output(unwrapped.switch_on_next());
 }
 
 ObservableImpl ObservableImpl::take(unsigned int numValues) const
 {
-    return wrap(unwrap(wrapped).take(numValues));
+    const OperatorProbe probe(getChainName(*this), "take");
+    return probe.output(probe.input(wrapped).take(numValues));
 }
 
 ObservableImpl ObservableImpl::takeLast(unsigned int numValues) const
 {
-    return wrap(unwrap(wrapped).take_last(numValues));
+    const OperatorProbe probe(getChainName(*this), "takeLast");
+    return probe.output(probe.input(wrapped).take_last(numValues));
 }
 
 ObservableImpl ObservableImpl::takeUntil(const ObservableImpl& other) const
 {
-    return wrap(unwrap(wrapped).take_until(unwrap(other.wrapped)));
+    const OperatorProbe probe(getChainName(*this), "takeUntil");
+    return probe.output(probe.input(wrapped).take_until(unwrap(other.wrapped)));
 }
 
 ObservableImpl ObservableImpl::takeWhile(const std::function<bool(const any&)>& predicate) const
 {
+    const OperatorProbe probe(getChainName(*this), "takeWhile");
+    const auto function = probe.callback(predicate);
+
     // On Visual Studio, the predicate must be wrapped in a lambda, otherwise RxCpp fails to compile
-    return wrap(unwrap(wrapped).take_while([predicate](const any& value) { return predicate(value); }));
+    return probe.output(probe.input(wrapped).take_while([function](const any& value) { return function(value); }));
 }
 
 ObservableImpl ObservableImpl::withLatestFrom(std::initializer_list<ObservableImpl> others, const any& function) const {
@@ -380,16 +671,95 @@ ObservableImpl ObservableImpl::zip(std::initializer_list<ObservableImpl> others,
 }
 
 
+ObservableImpl ObservableImpl::lift(const std::function<Transform()>& makeTransform, const char* operatorName) const
+{
+    const OperatorProbe probe(getChainName(*this), operatorName);
+
+    return probe.output(_lift(probe.input(wrapped), [probe, makeTransform]() {
+        return probe.callback(makeTransform());
+    }));
+}
+
+ObservableImpl ObservableImpl::combine(const juce::Array<ObservableImpl>& observables, const std::function<std::shared_ptr<Combiner>()>& makeCombiner, const char* operatorName)
+{
+    const OperatorProbe probe((observables.isEmpty() ? String() : getChainName(observables.getReference(0))), operatorName);
+
+    std::vector<rxcpp::observable<any>> sources;
+    sources.reserve(static_cast<size_t>(observables.size()));
+    for (auto& observable : observables)
+        sources.push_back(probe.input(observable.wrapped));
+
+    return probe.output(rxcpp::observable<>::create<any>([sources, makeCombiner, probe](rxcpp::subscriber<any> destination) {
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+        const std::shared_ptr<Combiner> combiner = std::make_shared<ProbedCombiner>(makeCombiner(), probe);
+#else
+        const std::shared_ptr<Combiner> combiner = makeCombiner();
+#endif
+
+        if (combiner->isCompleted()) {
+            destination.on_completed();
+            return;
+        }
+
+        for (size_t i = 0; i < sources.size() && destination.is_subscribed(); ++i) {
+            // Each source gets its own subscription, so that it can complete without unsubscribing the others
+            rxcpp::composite_subscription lifetime;
+            destination.add(lifetime);
+
+            sources[i].subscribe(lifetime,
+                                 [destination, combiner, i](const any& value) {
+                                     any result(value);
+                                     bool shouldEmit = false;
+                                     try {
+                                         shouldEmit = combiner->onNext(i, value, result);
+                                     }
+                                     catch (...) {
+                                         destination.on_error(std::current_exception());
+                                         return;
+                                     }
+
+                                     if (shouldEmit)
+                                         destination.on_next(std::move(result));
+
+                                     if (combiner->isCompleted())
+                                         destination.on_completed();
+                                 },
+                                 [destination](std::exception_ptr error) {
+                                     destination.on_error(error);
+                                 },
+                                 [destination, combiner, i]() {
+                                     combiner->onCompleted(i);
+                                     if (combiner->isCompleted())
+                                         destination.on_completed();
+                                 });
+        }
+    }));
+}
+
+
 #pragma mark - Scheduling
 
 ObservableImpl ObservableImpl::observeOn(const SchedulerImpl& scheduler) const
 {
-    return wrap(scheduler.schedule(unwrap(wrapped)));
+    const OperatorProbe probe(getChainName(*this), "observeOn");
+    return probe.output(scheduler.schedule(probe.input(wrapped)));
 }
 
 
 #pragma mark - Misc
 
+ObservableImpl ObservableImpl::named(const juce::String& newName) const
+{
+    ObservableImpl observable(*this);
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+    observable.name = newName;
+#else
+    ignoreUnused(newName);
+#endif
+
+    return observable;
+}
+
 juce::Array<any> ObservableImpl::toArray(const std::function<void(std::exception_ptr)>& onError) const
 {
     Array<any> values;
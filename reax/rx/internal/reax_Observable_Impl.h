@@ -5,10 +5,11 @@ class Scheduler;
 namespace detail {
 struct ObserverImpl;
 struct SchedulerImpl;
+struct FusedStages;
 
 struct ObservableImpl
 {
-    ObservableImpl(const any& wrapped);
+    ObservableImpl(const any& wrapped, const std::shared_ptr<const FusedStages>& fusedStages = nullptr);
 
     // Creation
     static ObservableImpl create(const std::function<void(ObserverImpl&&)>& onSubscribe);
@@ -33,6 +34,8 @@ struct ObservableImpl
     Subscription subscribe(const ObserverImpl& observer) const;
 
     // Operators
+    ObservableImpl bufferCount(unsigned int count) const;
+    ObservableImpl bufferTime(const juce::RelativeTime& period) const;
     ObservableImpl combineLatest(std::initializer_list<ObservableImpl> others, const any& function) const;
     ObservableImpl concat(const juce::Array<ObservableImpl>& others) const;
     ObservableImpl debounce(const juce::RelativeTime& interval) const;
@@ -56,20 +59,55 @@ struct ObservableImpl
     ObservableImpl withLatestFrom(std::initializer_list<ObservableImpl> others, const any& function) const;
     ObservableImpl zip(std::initializer_list<ObservableImpl> others, const any& function) const;
 
+    // Transforms a value into zero or one values. Assigns the new value to `result` and returns true, or returns false if nothing should be emitted.
+    typedef std::function<bool(const any& value, any& result)> Transform;
+
+    // Calls makeTransform on each new subscription, and then calls the returned Transform for each value. Exceptions thrown by the Transform are forwarded to onError.
+    // The operatorName is only used for instrumentation.
+    ObservableImpl lift(const std::function<Transform()>& makeTransform, const char* operatorName = "lift") const;
+
+    // Combines the values of any number of Observables. Used by the operators that take an Array of Observables (e.g. Observable::combineLatest(const juce::Array<Observable<T>>&)).
+    // A new Combiner is created for each subscription, so it can keep the per-subscription state (e.g. the latest values).
+    struct Combiner
+    {
+        virtual ~Combiner() {}
+
+        // Called when the Observable at `index` emits a value. Assigns the combined value to `result` and returns true, or returns false if nothing should be emitted.
+        virtual bool onNext(size_t index, const any& value, any& result) = 0;
+
+        // Called when the Observable at `index` completes.
+        virtual void onCompleted(size_t index) = 0;
+
+        // Returns true if the combined Observable should complete.
+        virtual bool isCompleted() const = 0;
+    };
+
+    // The operatorName is only used for instrumentation.
+    static ObservableImpl combine(const juce::Array<ObservableImpl>& observables, const std::function<std::shared_ptr<Combiner>()>& makeCombiner, const char* operatorName);
+
     // Scheduling
     ObservableImpl observeOn(const SchedulerImpl& scheduler) const;
 
     // Misc
+    ObservableImpl named(const juce::String& name) const;
     juce::Array<any> toArray(const std::function<void(std::exception_ptr)>& onError) const;
 
     // Default error/completion handlers
     [[ noreturn ]] static void TerminateOnError(std::exception_ptr);
     static void EmptyOnCompleted();
     
-    // The maximum number of parameters for operators like combineLatest, merge, zip, etc., NOT including the observable it is called on
+    // The maximum number of parameters for the variadic operators combineLatest, withLatestFrom and zip, NOT including the observable it is called on
     static const int MaximumArity = 7;
 
     // The wrapped rxcpp::observable<any>
     any wrapped;
+
+    // If this Observable was created by consecutive map/filter operators, these are the operators' functions. Another map or filter is fused with them into a single operator.
+    std::shared_ptr<const FusedStages> fusedStages;
+
+#if REAX_ENABLE_INSTRUMENTATION || REAX_ENABLE_TRACING
+    // The name of the chain (set by Observable::named). Operators that are applied to this Observable record their counters and trace events under this name.
+    juce::String name;
+#endif
 };
 }
@@ -3,8 +3,14 @@ ObserverImpl::ObserverImpl(const any& wrapped)
 : wrapped(wrapped)
 {}
 
+ObserverImpl ObserverImpl::fromFunction(const std::function<void(const any&)>& onNext)
+{
+    return ObserverImpl(any(rxcpp::make_subscriber<any>([onNext](const any& value) { onNext(value); }).as_dynamic()));
+}
+
 void ObserverImpl::onNext(any&& next) const
 {
+    REAX_CHECK_REALTIME_SAFE("Calling Observer::onNext");
     wrapped.get<rxcpp::subscriber<any>>().on_next(std::move(next));
 }
 
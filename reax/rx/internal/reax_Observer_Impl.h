@@ -4,6 +4,7 @@ namespace detail {
     struct ObserverImpl
     {
         ObserverImpl(const any& wrapped);
+        static ObserverImpl fromFunction(const std::function<void(const any&)>& onNext);
         void onNext(any&& next) const;
         void onError(std::exception_ptr error) const;
         void onCompleted() const;
@@ -1,4 +1,443 @@
 namespace {
+/*
+ Decides when an object that has been replaced with an atomic exchange can't be accessed by a reader anymore, so that it can be deleted or reused. Readers are wait-free, and a reader that keeps reading can't prevent reclamation.
+
+ Each read is counted in one of two counters, chosen by the parity of the current epoch. Replaced objects are retired into the list of the current epoch. When an object is retired and the counter of the other parity is 0, all reads that started before the current epoch have finished. Then the objects retired in the previous epoch are reclaimed, and the epoch advances. New reads are counted with the new parity, so the other counter only has to wait for the reads that were already in progress.
+
+ So a retired object is reclaimed at the latest by the second retire() after all reads that overlapped its replacement have finished. Only one thread may retire objects at a time (e.g. while holding a mutex).
+ */
+template<typename T>
+class EpochReclaimer
+{
+public:
+    // Counts a read while it exists. The reader must load the atomic pointer after creating this.
+    class ScopedRead
+    {
+    public:
+        explicit ScopedRead(const EpochReclaimer& reclaimer)
+        : numReaders(reclaimer.numReaders[reclaimer.epoch.load() & 1])
+        {
+            ++numReaders;
+        }
+
+        ~ScopedRead()
+        {
+            --numReaders;
+        }
+
+    private:
+        std::atomic<int>& numReaders;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedRead)
+    };
+
+    ~EpochReclaimer()
+    {
+        for (auto& objects : retired) {
+            for (auto object : objects)
+                delete object;
+        }
+
+        deleteReclaimed();
+    }
+
+    // Retires an object that has been replaced, and reclaims the objects that no reader can access anymore
+    void retire(T* object)
+    {
+        retired[epoch.load() & 1].push_back(object);
+
+        // All atomics are sequentially consistent: A read that is counted after the check loads the object that is current at that point, which isn't retired yet.
+        // If both counters are 0, this advances twice, so the object that has just been retired is reclaimed immediately.
+        for (int i = 0; i < 2; ++i) {
+            const auto currentEpoch = epoch.load();
+            const auto previousParity = (currentEpoch + 1) & 1;
+            if (numReaders[previousParity].load() != 0)
+                break;
+
+            reclaimed.insert(reclaimed.end(), retired[previousParity].begin(), retired[previousParity].end());
+            retired[previousParity].clear();
+            epoch.store(currentEpoch + 1);
+        }
+    }
+
+    // Returns a reclaimed object to reuse, or nullptr if there is none
+    T* takeReclaimed()
+    {
+        if (reclaimed.empty())
+            return nullptr;
+
+        T* object = reclaimed.back();
+        reclaimed.pop_back();
+        return object;
+    }
+
+    void deleteReclaimed()
+    {
+        for (auto object : reclaimed)
+            delete object;
+
+        reclaimed.clear();
+    }
+
+private:
+    std::atomic<juce::uint64> epoch{ 0 };
+    mutable std::atomic<int> numReaders[2]{};
+
+    // Only used by the retiring thread
+    std::vector<T*> retired[2];
+    std::vector<T*> reclaimed;
+
+    JUCE_DECLARE_NON_COPYABLE(EpochReclaimer)
+};
+
+/*
+ The shared state of a PublishSubject. It sends each value to all of its subscribers, without locking and without allocating memory.
+
+ The subscribers are kept in an immutable array. Subscribing and unsubscribing (which are rare, compared to emitting) create a new array under a mutex, and publish it with an atomic exchange (copy-on-write). So onNext just loads the current array and iterates it, and it's never blocked by a thread that subscribes or unsubscribes.
+
+ A replaced array is retired, and deleted once every emission that may still be iterating it has finished (see EpochReclaimer). This doesn't need a moment in which no thread is emitting, so it works with continuous emission from several threads. Retired arrays are only deleted when subscribing or unsubscribing (or on destruction), so onNext doesn't free memory either. Until then, an array keeps its (possibly unsubscribed) subscribers alive.
+ */
+class FanOut : public std::enable_shared_from_this<FanOut>
+{
+public:
+    FanOut()
+    : current(new Subscribers())
+    {}
+
+    ~FanOut()
+    {
+        delete current.load();
+    }
+
+    // The index is only used by ReplayFanOut: The value is only sent to subscribers that were added with a firstIndex <= index.
+    void onNext(const any& value, juce::uint64 index = 0)
+    {
+        const EpochReclaimer<Subscribers>::ScopedRead emission(reclaimer);
+
+        for (auto& entry : *current.load()) {
+            if (entry.firstIndex <= index)
+                entry.subscriber.on_next(value);
+        }
+    }
+
+    void onError(std::exception_ptr error)
+    {
+        for (auto& entry : stop(true, error))
+            entry.subscriber.on_error(error);
+    }
+
+    void onCompleted()
+    {
+        for (auto& entry : stop(false, nullptr))
+            entry.subscriber.on_completed();
+    }
+
+    void subscribe(const rxcpp::subscriber<any>& subscriber)
+    {
+        if (!add(subscriber, 0))
+            notifyStopped(subscriber);
+    }
+
+    // Returns false (without notifying the subscriber) if the subject has already been stopped
+    bool add(const rxcpp::subscriber<any>& subscriber, juce::uint64 firstIndex)
+    {
+        REAX_CHECK_REALTIME_SAFE("Subscribing to a Subject");
+        std::unique_lock<std::mutex> lock(mutex);
+        if (isStopped)
+            return false;
+
+        const juce::uint64 id = nextId++;
+        Subscribers* newSubscribers = new Subscribers(*current.load());
+        newSubscribers->push_back(Entry{ id, firstIndex, subscriber });
+        publish(newSubscribers);
+        lock.unlock();
+
+        // If the subscriber is already unsubscribed, this calls unsubscribe immediately
+        const std::weak_ptr<FanOut> weakThis(shared_from_this());
+        subscriber.add([weakThis, id]() {
+            if (auto fanOut = weakThis.lock())
+                fanOut->unsubscribe(id);
+        });
+
+        return true;
+    }
+
+    // Calls onError or onCompleted on a subscriber that couldn't be added
+    void notifyStopped(const rxcpp::subscriber<any>& subscriber)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        const bool stoppedWithError = hasError;
+        const std::exception_ptr stopError = error;
+        lock.unlock();
+
+        if (stoppedWithError)
+            subscriber.on_error(stopError);
+        else
+            subscriber.on_completed();
+    }
+
+private:
+    struct Entry
+    {
+        juce::uint64 id;
+        juce::uint64 firstIndex;
+        rxcpp::subscriber<any> subscriber;
+    };
+
+    typedef std::vector<Entry> Subscribers;
+
+    std::atomic<Subscribers*> current;
+
+    // Only retires while holding the mutex
+    EpochReclaimer<Subscribers> reclaimer;
+
+    // Only used while holding the mutex
+    std::mutex mutex;
+    juce::uint64 nextId = 0;
+    bool isStopped = false;
+    bool hasError = false;
+    std::exception_ptr error;
+
+    void unsubscribe(juce::uint64 id)
+    {
+        REAX_CHECK_REALTIME_SAFE("Unsubscribing from a Subject");
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        const Subscribers& subscribers = *current.load();
+        const auto isRemoved = [id](const Entry& entry) { return entry.id == id; };
+        if (std::find_if(subscribers.begin(), subscribers.end(), isRemoved) == subscribers.end())
+            return;
+
+        Subscribers* newSubscribers = new Subscribers(subscribers);
+        newSubscribers->erase(std::remove_if(newSubscribers->begin(), newSubscribers->end(), isRemoved), newSubscribers->end());
+        publish(newSubscribers);
+    }
+
+    // Removes all subscribers and returns them, so they can be notified without holding the mutex
+    Subscribers stop(bool withError, std::exception_ptr stopError)
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (isStopped)
+            return Subscribers();
+
+        isStopped = true;
+        hasError = withError;
+        error = stopError;
+
+        Subscribers subscribers(*current.load());
+        publish(new Subscribers());
+        return subscribers;
+    }
+
+    // Must be called while holding the mutex
+    void publish(Subscribers* newSubscribers)
+    {
+        reclaimer.retire(current.exchange(newSubscribers));
+        reclaimer.deleteReclaimed();
+    }
+
+    JUCE_DECLARE_NON_COPYABLE(FanOut)
+};
+
+/*
+ The shared state of a ReplaySubject with a limited buffer size. It keeps the latest values in a ring buffer, which is allocated once. When it's full, each new value overwrites the oldest one.
+
+ Each value gets an index. A new subscriber first gets the values in the ring buffer, one at a time: Each value is copied out of the ring buffer while holding the mutex, and emitted after releasing it. Copying an `any` doesn't copy objects on the heap, they are shared by reference. Once the subscriber has caught up with the latest value, it's added to the FanOut, and only gets the values with a higher index from there on. So it gets each value exactly once, and in order, even if other threads emit values during the replay.
+ */
+class ReplayFanOut
+{
+public:
+    explicit ReplayFanOut(size_t capacity)
+    : fanOut(std::make_shared<FanOut>()),
+      capacity(capacity)
+    {
+        values.reserve(capacity);
+    }
+
+    void onNext(const any& value)
+    {
+        juce::uint64 index;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            if (values.size() < capacity)
+                values.push_back(value);
+            else if (capacity > 0)
+                values[static_cast<size_t>(numValues % capacity)] = value;
+
+            index = ++numValues;
+        }
+
+        fanOut->onNext(value, index);
+    }
+
+    void onError(std::exception_ptr error)
+    {
+        fanOut->onError(error);
+    }
+
+    void onCompleted()
+    {
+        fanOut->onCompleted();
+    }
+
+    void subscribe(const rxcpp::subscriber<any>& subscriber)
+    {
+        juce::uint64 nextIndex = 0;
+
+        for (;;) {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            // Skip the values that have been overwritten in the meantime
+            nextIndex = std::max<juce::uint64>(nextIndex, numValues - values.size());
+
+            if (nextIndex == numValues) {
+                // Caught up: Get the values with a higher index from the FanOut.
+                const bool isAdded = fanOut->add(subscriber, numValues + 1);
+                lock.unlock();
+
+                if (!isAdded)
+                    fanOut->notifyStopped(subscriber);
+
+                return;
+            }
+
+            const any value(values[static_cast<size_t>(nextIndex % capacity)]);
+            ++nextIndex;
+            lock.unlock();
+
+            subscriber.on_next(value);
+            if (!subscriber.is_subscribed())
+                return;
+        }
+    }
+
+private:
+    const std::shared_ptr<FanOut> fanOut;
+    const size_t capacity;
+
+    // Only used while holding the mutex
+    std::mutex mutex;
+    std::vector<any> values;
+    juce::uint64 numValues = 0;
+
+    JUCE_DECLARE_NON_COPYABLE(ReplayFanOut)
+};
+
+/*
+ The shared state of a BehaviorSubject. Like a ReplayFanOut with a buffer size of 1, but the latest value can also be read without locking, from any thread.
+
+ The latest value is kept in an immutable snapshot, which is replaced with an atomic exchange. getValue() copies the current snapshot without locking or waiting. A replaced snapshot is retired, and reused for a later value once every read that may still access it has finished (with an EpochReclaimer, like the retired arrays in FanOut). So a thread that polls getValue continuously doesn't make the number of snapshots grow: onNext only allocates a new snapshot while reads overlap the last few replacements, and the snapshots stay allocated for reuse.
+ */
+class BehaviorFanOut
+{
+public:
+    explicit BehaviorFanOut(any&& initial)
+    : fanOut(std::make_shared<FanOut>()),
+      current(new any(std::move(initial)))
+    {}
+
+    ~BehaviorFanOut()
+    {
+        delete current.load();
+    }
+
+    any getValue() const
+    {
+        const EpochReclaimer<any>::ScopedRead read(reclaimer);
+        return *current.load();
+    }
+
+    void onNext(const any& value)
+    {
+        juce::uint64 index;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            reclaimer.retire(current.exchange(makeSnapshot(value)));
+            index = ++numValues;
+        }
+
+        fanOut->onNext(value, index);
+    }
+
+    void onError(std::exception_ptr error)
+    {
+        stop();
+        fanOut->onError(error);
+    }
+
+    void onCompleted()
+    {
+        stop();
+        fanOut->onCompleted();
+    }
+
+    void subscribe(const rxcpp::subscriber<any>& subscriber)
+    {
+        juce::uint64 emittedIndex = 0;
+
+        for (;;) {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            if (isStopped) {
+                lock.unlock();
+                fanOut->notifyStopped(subscriber);
+                return;
+            }
+
+            if (emittedIndex == numValues) {
+                // Caught up: Get the values with a higher index from the FanOut.
+                const bool isAdded = fanOut->add(subscriber, numValues + 1);
+                lock.unlock();
+
+                if (!isAdded)
+                    fanOut->notifyStopped(subscriber);
+
+                return;
+            }
+
+            // The snapshot is only replaced while holding the mutex
+            const any value(*current.load());
+            emittedIndex = numValues;
+            lock.unlock();
+
+            subscriber.on_next(value);
+            if (!subscriber.is_subscribed())
+                return;
+        }
+    }
+
+private:
+    const std::shared_ptr<FanOut> fanOut;
+    std::atomic<any*> current;
+
+    // Only retires while holding the mutex
+    EpochReclaimer<any> reclaimer;
+
+    // Only used while holding the mutex. The initial value has index 1.
+    std::mutex mutex;
+    juce::uint64 numValues = 1;
+    bool isStopped = false;
+
+    // Must be called while holding the mutex
+    any* makeSnapshot(const any& value)
+    {
+        any* snapshot = reclaimer.takeReclaimed();
+        if (snapshot == nullptr)
+            return new any(value);
+
+        *snapshot = value;
+        return snapshot;
+    }
+
+    void stop()
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        isStopped = true;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE(BehaviorFanOut)
+};
+
 template<typename SubjectType, typename... Args>
 detail::SubjectImpl MakeSubjectImpl(Args&&... args)
 {
@@ -6,27 +445,46 @@ detail::SubjectImpl MakeSubjectImpl(Args&&... args)
     auto subject = std::make_shared<SubjectType>(std::forward<Args>(args)...);
     return detail::SubjectImpl(any(subject), any(subject->get_subscriber().as_dynamic()), any(subject->get_observable().as_dynamic()));
 }
+
+// Creates a SubjectImpl for a FanOut, ReplayFanOut or BehaviorFanOut
+template<typename FanOutType>
+detail::SubjectImpl MakeFanOutSubjectImpl(const std::shared_ptr<FanOutType>& fanOut)
+{
+    const auto observer = rxcpp::make_subscriber<any>([fanOut](const any& value) { fanOut->onNext(value); },
+                                                      [fanOut](std::exception_ptr error) { fanOut->onError(error); },
+                                                      [fanOut]() { fanOut->onCompleted(); });
+
+    const auto observable = rxcpp::observable<>::create<any>([fanOut](const rxcpp::subscriber<any>& subscriber) {
+        fanOut->subscribe(subscriber);
+    });
+
+    return detail::SubjectImpl(any(fanOut), any(observer.as_dynamic()), any(observable.as_dynamic()));
+}
 }
 
 namespace detail {
 SubjectImpl SubjectImpl::MakeBehaviorSubjectImpl(any&& initial)
 {
-    return MakeSubjectImpl<rxcpp::subjects::behavior<any>>(std::move(initial));
+    return MakeFanOutSubjectImpl(std::make_shared<BehaviorFanOut>(std::move(initial)));
 }
 
 SubjectImpl SubjectImpl::MakePublishSubjectImpl()
 {
-    return MakeSubjectImpl<rxcpp::subjects::subject<any>>();
+    return MakeFanOutSubjectImpl(std::make_shared<FanOut>());
 }
 
 SubjectImpl SubjectImpl::MakeReplaySubjectImpl(size_t bufferSize)
 {
-    return MakeSubjectImpl<rxcpp::subjects::replay<any, rxcpp::identity_one_worker>>(bufferSize, rxcpp::identity_immediate());
+    // Without a limit, the values are kept in a growing buffer
+    if (bufferSize == std::numeric_limits<size_t>::max())
+        return MakeSubjectImpl<rxcpp::subjects::replay<any, rxcpp::identity_one_worker>>(bufferSize, rxcpp::identity_immediate());
+
+    return MakeFanOutSubjectImpl(std::make_shared<ReplayFanOut>(bufferSize));
 }
 
 any SubjectImpl::getValue() const
 {
-    return wrapped.get<std::shared_ptr<rxcpp::subjects::behavior<any>>>()->get_value();
+    return wrapped.get<std::shared_ptr<BehaviorFanOut>>()->getValue();
 }
 
 SubjectImpl::SubjectImpl(const any& subject, const any& observer, const any& observable)
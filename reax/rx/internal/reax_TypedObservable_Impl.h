@@ -0,0 +1,197 @@
+#pragma once
+
+namespace detail {
+/*
+ The stages of a TypedObservable pipeline. Each stage holds its upstream stage by value, so the whole pipeline is one concrete type and the compiler can inline all stages into a single function.
+
+ A stage is called with a value of the pipeline's InputType and an `emit` functor. It passes zero or one values of its ValueType to `emit`.
+
+ Stages may have state (e.g. ScanStage). A pipeline is copied for each subscription, so each subscription gets its own state.
+*/
+template<typename T>
+struct IdentityStage
+{
+    typedef T InputType;
+    typedef T ValueType;
+
+    template<typename Emit>
+    void operator()(const T& value, Emit& emit)
+    {
+        emit(value);
+    }
+};
+
+template<typename Upstream, typename Function>
+struct MapStage
+{
+    typedef typename Upstream::InputType InputType;
+    typedef typename std::decay<typename std::result_of<Function&(const typename Upstream::ValueType&)>::type>::type ValueType;
+
+    template<typename Emit>
+    struct Next
+    {
+        Function& function;
+        Emit& emit;
+
+        void operator()(const typename Upstream::ValueType& value)
+        {
+            emit(function(value));
+        }
+    };
+
+    template<typename Emit>
+    void operator()(const InputType& value, Emit& emit)
+    {
+        Next<Emit> next{ function, emit };
+        upstream(value, next);
+    }
+
+    Upstream upstream;
+    Function function;
+};
+
+template<typename Upstream, typename Predicate>
+struct FilterStage
+{
+    typedef typename Upstream::InputType InputType;
+    typedef typename Upstream::ValueType ValueType;
+
+    template<typename Emit>
+    struct Next
+    {
+        Predicate& predicate;
+        Emit& emit;
+
+        void operator()(const ValueType& value)
+        {
+            if (predicate(value))
+                emit(value);
+        }
+    };
+
+    template<typename Emit>
+    void operator()(const InputType& value, Emit& emit)
+    {
+        Next<Emit> next{ predicate, emit };
+        upstream(value, next);
+    }
+
+    Upstream upstream;
+    Predicate predicate;
+};
+
+template<typename Upstream, typename Accumulator, typename Function>
+struct ScanStage
+{
+    typedef typename Upstream::InputType InputType;
+    typedef Accumulator ValueType;
+
+    template<typename Emit>
+    struct Next
+    {
+        Accumulator& accumulator;
+        Function& function;
+        Emit& emit;
+
+        void operator()(const typename Upstream::ValueType& value)
+        {
+            accumulator = function(static_cast<const Accumulator&>(accumulator), value);
+            emit(static_cast<const Accumulator&>(accumulator));
+        }
+    };
+
+    template<typename Emit>
+    void operator()(const InputType& value, Emit& emit)
+    {
+        Next<Emit> next{ accumulator, function, emit };
+        upstream(value, next);
+    }
+
+    Upstream upstream;
+    Accumulator accumulator;
+    Function function;
+};
+
+template<typename Upstream, typename Equals>
+struct DistinctUntilChangedStage
+{
+    typedef typename Upstream::InputType InputType;
+    typedef typename Upstream::ValueType ValueType;
+
+    DistinctUntilChangedStage(const Upstream& upstream, const Equals& equals)
+    : upstream(upstream),
+      equals(equals)
+    {}
+
+    // The latest value is not copied: Each subscription starts without a latest value.
+    DistinctUntilChangedStage(const DistinctUntilChangedStage& other)
+    : upstream(other.upstream),
+      equals(other.equals)
+    {}
+
+    template<typename Emit>
+    struct Next
+    {
+        std::unique_ptr<ValueType>& latest;
+        Equals& equals;
+        Emit& emit;
+
+        void operator()(const ValueType& value)
+        {
+            if (latest && equals(static_cast<const ValueType&>(*latest), value))
+                return;
+
+            // Allocates only once per subscription
+            if (latest)
+                *latest = value;
+            else
+                latest.reset(new ValueType(value));
+
+            emit(value);
+        }
+    };
+
+    template<typename Emit>
+    void operator()(const InputType& value, Emit& emit)
+    {
+        Next<Emit> next{ latest, equals, emit };
+        upstream(value, next);
+    }
+
+    Upstream upstream;
+    Equals equals;
+    std::unique_ptr<ValueType> latest;
+};
+
+template<typename Upstream>
+struct SkipStage
+{
+    typedef typename Upstream::InputType InputType;
+    typedef typename Upstream::ValueType ValueType;
+
+    template<typename Emit>
+    struct Next
+    {
+        unsigned int& numRemaining;
+        Emit& emit;
+
+        void operator()(const ValueType& value)
+        {
+            if (numRemaining > 0)
+                --numRemaining;
+            else
+                emit(value);
+        }
+    };
+
+    template<typename Emit>
+    void operator()(const InputType& value, Emit& emit)
+    {
+        Next<Emit> next{ numRemaining, emit };
+        upstream(value, next);
+    }
+
+    Upstream upstream;
+    unsigned int numRemaining;
+};
+}
@@ -0,0 +1,71 @@
+#if REAX_ENABLE_INSTRUMENTATION
+namespace {
+// All operator counters, by name
+struct OperatorRegistry
+{
+    std::mutex mutex;
+    std::map<String, std::shared_ptr<detail::OperatorCounters>> counters;
+};
+
+OperatorRegistry& getOperatorRegistry()
+{
+    static OperatorRegistry registry;
+    return registry;
+}
+}
+
+std::shared_ptr<detail::OperatorCounters> detail::getOperatorCounters(const juce::String& name)
+{
+    REAX_CHECK_REALTIME_SAFE("Creating an instrumented Observable operator");
+
+    auto& registry = getOperatorRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto& counters = registry.counters[name];
+    if (!counters)
+        counters = std::make_shared<OperatorCounters>();
+
+    return counters;
+}
+#endif
+
+bool Instrumentation::isEnabled()
+{
+    return bool(REAX_ENABLE_INSTRUMENTATION);
+}
+
+juce::Array<OperatorStatistics> Instrumentation::getSnapshot()
+{
+    Array<OperatorStatistics> snapshot;
+
+#if REAX_ENABLE_INSTRUMENTATION
+    auto& registry = getOperatorRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // std::map is sorted by name
+    for (auto& entry : registry.counters) {
+        const auto& counters = *entry.second;
+        snapshot.add({ entry.first,
+                       counters.numValuesIn.load(std::memory_order_relaxed),
+                       counters.numValuesOut.load(std::memory_order_relaxed),
+                       RelativeTime(Time::highResolutionTicksToSeconds(counters.callbackTicks.load(std::memory_order_relaxed))),
+                       counters.numSubscribers.load(std::memory_order_relaxed) });
+    }
+#endif
+
+    return snapshot;
+}
+
+void Instrumentation::resetCounters()
+{
+#if REAX_ENABLE_INSTRUMENTATION
+    auto& registry = getOperatorRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for (auto& entry : registry.counters) {
+        entry.second->numValuesIn.store(0, std::memory_order_relaxed);
+        entry.second->numValuesOut.store(0, std::memory_order_relaxed);
+        entry.second->callbackTicks.store(0, std::memory_order_relaxed);
+    }
+#endif
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+/**
+ The counters of all Observable operators with the same name, e.g. all `map` operators of the chain named "meterChain".
+
+ @see Instrumentation
+ */
+struct OperatorStatistics
+{
+    /// The name of the operator, prefixed with the name of its chain (if any). For example "meterChain/map", or just "map".
+    juce::String name;
+
+    /// The number of values that the operators have received.
+    juce::int64 numValuesIn;
+
+    /// The number of values that the operators have emitted.
+    juce::int64 numValuesOut;
+
+    /// The total time spent in the functions passed to the operators (e.g. the function passed to `map`).
+    juce::RelativeTime timeInCallbacks;
+
+    /// The current number of subscriptions to the operators.
+    int numSubscribers;
+};
+
+/**
+ Reads the counters that Observable operators record if `REAX_ENABLE_INSTRUMENTATION` is set to 1. Use this to find out which chain is responsible when your app gets slow.
+
+ Each operator is recorded under its own name (like "map"), prefixed with the name of its chain. Name a chain by calling Observable::named before applying the operators:
+
+     Observable<float> dB = meterSource.named("meterChain")
+         .map([](float level) { return Decibels::gainToDecibels(level); })
+         .filter([](float dB) { return dB > -60.f; });
+
+ Operators with the same name are counted together.
+ */
+class Instrumentation
+{
+public:
+    /// Returns true if the module is compiled with `REAX_ENABLE_INSTRUMENTATION`.
+    static bool isEnabled();
+
+    /// Returns the current counters of all operators that have been created so far, sorted by name. Returns an empty Array if instrumentation is disabled. Can be called from any thread.
+    static juce::Array<OperatorStatistics> getSnapshot();
+
+    /// Sets the value and time counters of all operators to zero, e.g. to measure a specific time span. The subscriber counts are not reset.
+    static void resetCounters();
+
+private:
+    Instrumentation() = delete;
+};
@@ -3,6 +3,14 @@
 template<typename T>
 class Observer;
 
+template<typename T, typename Pipeline>
+class TypedObservable;
+
+namespace detail {
+template<typename T>
+struct IdentityStage;
+}
+
 /**
  An Observable emits values over time.
  
@@ -238,6 +246,29 @@ public:
 
 
 #pragma mark - Operators
+    /**
+     Collects the values from this Observable into blocks of `count` values, and emits each block as an Array. When this Observable completes, the remaining values (if any) are emitted as a smaller block.
+     
+     Use this to process values in blocks, e.g. to update a meter once per block instead of once per value.
+     */
+    Observable<juce::Array<T>> bufferCount(unsigned int count) const
+    {
+        // The count must be > 0.
+        jassert(count > 0);
+
+        return impl.bufferCount(count).map(&toTypedArray);
+    }
+
+    /**
+     Collects the values from this Observable during each `period`, and emits them as an Array at the end of the period. If no values were emitted during a period, an empty Array is emitted.
+     
+     The `period` has millisecond resolution.
+     */
+    Observable<juce::Array<T>> bufferTime(const juce::RelativeTime& period) const
+    {
+        return impl.bufferTime(period).map(&toTypedArray);
+    }
+
     ///@{
     /**
      Returns an Observable that emits **whenever** a value is emitted by either this Observable **or** one of the `others`. It combines the **latest** value from each Observable via the given function and emits what was returned by the function.
@@ -266,6 +297,32 @@ public:
     }
     ///@}
 
+    ///@{
+    /**
+     Returns an Observable that emits **whenever** one of the `observables` emits a value. It emits an Array with the **latest** value from each Observable (in the order of `observables`), or the result of calling `function` with this Array.
+     
+     It only emits after each of the `observables` has emitted at least one value, and completes when all of them have completed.
+     
+     Unlike the other Observable::combineLatest, this takes any number of Observables (e.g. one per channel of a mixer). A new value only updates its own element in the Array, so the cost per value doesn't grow with the number of Observables (apart from copying the Array, if you don't pass a `function`).
+     */
+    static Observable<juce::Array<T>> combineLatest(const juce::Array<Observable<T>>& observables)
+    {
+        return combineLatest(observables, [](const juce::Array<T>& latestValues) { return latestValues; });
+    }
+    /// \overload
+    template<typename Function>
+    static Observable<CallResult<Function, const juce::Array<T>&>> combineLatest(const juce::Array<Observable<T>>& observables, Function&& function)
+    {
+        typedef LatestValuesCombiner<typename std::decay<Function>::type> Combiner;
+        const auto numObservables = static_cast<size_t>(observables.size());
+        const typename std::decay<Function>::type f(std::forward<Function>(function));
+
+        return Impl::combine(toImpls(observables), [numObservables, f]() {
+            return std::make_shared<Combiner>(numObservables, f);
+        }, "combineLatest");
+    }
+    ///@}
+
     /**
      Returns an Observable that first emits the values from this Observable, then from the first in the `others` list, then from the second, and so on.
      
@@ -276,9 +333,6 @@ public:
         // Must pass at least one other Observable:
         jassert(others.size() > 0);
 
-        // Too many Observables passed to concat:
-        jassert(others.size() <= Impl::MaximumArity);
-
         juce::Array<Impl> otherImpls;
         for (auto& other : others)
             otherImpls.add(other.impl);
@@ -286,6 +340,17 @@ public:
         return impl.concat(otherImpls);
     }
 
+    /**
+     Returns an Observable that emits the values from the first of the `observables`, then from the second, and so on. Same as the other Observable::concat, but takes an Array.
+     */
+    static Observable<T> concat(const juce::Array<Observable<T>>& observables)
+    {
+        if (observables.isEmpty())
+            return empty();
+
+        return observables.getFirst().impl.concat(toImpls(observables, 1));
+    }
+
     /**
      Returns an Observable which emits if `interval` has passed without this Observable emitting a value. The returned Observable emits the latest value from this Observable.
      
@@ -378,9 +443,6 @@ public:
         // Must pass at least one other Observable:
         jassert(others.size() > 0);
 
-        // Too many Observables:
-        jassert(others.size() <= Impl::MaximumArity);
-
         juce::Array<Impl> otherImpls;
         for (auto& other : others)
             otherImpls.add(other.impl);
@@ -388,6 +450,17 @@ public:
         return impl.merge(otherImpls);
     }
 
+    /**
+     Merges the emitted values of any number of `observables` into one Observable. Same as the other Observable::merge, but takes an Array.
+     */
+    static Observable<T> merge(const juce::Array<Observable<T>>& observables)
+    {
+        if (observables.isEmpty())
+            return empty();
+
+        return observables.getFirst().impl.merge(toImpls(observables, 1));
+    }
+
     /**
      Begins with a `startValue`, and then applies `f` to all values emitted by this Observable, and returns the aggregate result as a single-element Observable sequence.
      */
@@ -447,9 +520,6 @@ public:
         // Must pass at least one value:
         jassert(values.size() > 0);
 
-        // Too many values:
-        jassert(values.size() <= Impl::MaximumArity);
-
         juce::Array<any> anyValues;
         for (auto& value : values)
             anyValues.add(toAny(value));
@@ -557,7 +627,31 @@ public:
 
         return impl.zip({ others.impl... }, toAny(untypedFunction));
     }
-        ///@}
+    ///@}
+
+    ///@{
+    /**
+     Returns an Observable that emits whenever each of the `observables` has emitted a new value. It emits an Array with one value from each Observable (in the order of `observables`), or the result of calling `function` with this Array.
+     
+     Like the other Observable::zip, it combines the values in strict sequence, and completes when one of the `observables` has completed and all of its values have been emitted. But this takes any number of Observables.
+     */
+    static Observable<juce::Array<T>> zip(const juce::Array<Observable<T>>& observables)
+    {
+        return zip(observables, [](const juce::Array<T>& values) { return values; });
+    }
+    /// \overload
+    template<typename Function>
+    static Observable<CallResult<Function, const juce::Array<T>&>> zip(const juce::Array<Observable<T>>& observables, Function&& function)
+    {
+        typedef ZipCombiner<typename std::decay<Function>::type> Combiner;
+        const auto numObservables = static_cast<size_t>(observables.size());
+        const typename std::decay<Function>::type f(std::forward<Function>(function));
+
+        return Impl::combine(toImpls(observables), [numObservables, f]() {
+            return std::make_shared<Combiner>(numObservables, f);
+        }, "zip");
+    }
+    ///@}
 
 
 #pragma mark - Scheduling
@@ -583,6 +677,32 @@ public:
 
 
 #pragma mark - Misc
+    /**
+     Names the chain of operators that you apply to the returned Observable, for instrumentation and tracing. Their counters and trace events are recorded under this name (e.g. "meterChain/map"), until you call `named` again.
+
+     Does nothing unless `REAX_ENABLE_INSTRUMENTATION` or `REAX_ENABLE_TRACING` is set to 1. @see Instrumentation, Tracing
+     */
+    Observable<T> named(const juce::String& name) const
+    {
+        return impl.named(name);
+    }
+
+    /**
+     Returns a TypedObservable that emits the same values as this Observable. Operators applied to it are composed without type erasure, which is much faster for long chains on hot paths.
+     
+     For example:
+     
+         Observable<float> levels = meterSource.typed()
+             .map([](float level) { return Decibels::gainToDecibels(level); })
+             .filter([](float dB) { return dB > -60.f; });
+     
+     @see TypedObservable
+     */
+    TypedObservable<T, detail::IdentityStage<T>> typed() const
+    {
+        return TypedObservable<T, detail::IdentityStage<T>>(impl, detail::IdentityStage<T>());
+    }
+
     /**
      Blocks until the Observable has completed, then returns an Array of all emitted values.
      
@@ -611,6 +731,8 @@ private:
     friend class Observable;
     template<typename U>
     friend class Subject;
+    template<typename U, typename Pipeline>
+    friend class TypedObservable;
 
     Impl impl;
 
@@ -630,6 +752,142 @@ private:
         return any(u.impl);
     }
 
+    // Converts a block of values from Impl::bufferCount or Impl::bufferTime
+    static any toTypedArray(const any& values)
+    {
+        juce::Array<T> typedValues;
+        typedValues.ensureStorageAllocated(values.get<juce::Array<any>>().size());
+        for (auto& value : values.get<juce::Array<any>>())
+            typedValues.add(value.get<T>());
+
+        return toAny(typedValues);
+    }
+
+    static juce::Array<Impl> toImpls(const juce::Array<Observable<T>>& observables, int startIndex = 0)
+    {
+        juce::Array<Impl> impls;
+        impls.ensureStorageAllocated(observables.size() - startIndex);
+        for (int i = startIndex; i < observables.size(); ++i)
+            impls.add(observables.getReference(i).impl);
+
+        return impls;
+    }
+
+    // Keeps the latest value from each Observable, for the combineLatest that takes an Array. Values are collected separately until each Observable has emitted, so T doesn't need to be default-constructible.
+    template<typename Function>
+    class LatestValuesCombiner : public Impl::Combiner
+    {
+    public:
+        LatestValuesCombiner(size_t numObservables, const Function& function)
+        : firstValues(numObservables),
+          numMissing(numObservables),
+          numObservables(numObservables),
+          function(function)
+        {}
+
+        bool onNext(size_t index, const any& value, any& result) override
+        {
+            if (numMissing > 0) {
+                auto& firstValue = firstValues[index];
+                if (firstValue) {
+                    *firstValue = value.get<T>();
+                    return false;
+                }
+
+                firstValue.reset(new T(value.get<T>()));
+                if (--numMissing > 0)
+                    return false;
+
+                latestValues.ensureStorageAllocated(static_cast<int>(numObservables));
+                for (auto& v : firstValues)
+                    latestValues.add(std::move(*v));
+
+                firstValues.clear();
+            }
+            else
+                latestValues.getReference(static_cast<int>(index)) = value.get<T>();
+
+            result = toAny(function(static_cast<const juce::Array<T>&>(latestValues)));
+            return true;
+        }
+
+        void onCompleted(size_t) override
+        {
+            ++numCompleted;
+        }
+
+        bool isCompleted() const override
+        {
+            return numCompleted == numObservables;
+        }
+
+    private:
+        std::vector<std::unique_ptr<T>> firstValues;
+        juce::Array<T> latestValues;
+        size_t numMissing;
+        size_t numCompleted = 0;
+        const size_t numObservables;
+        Function function;
+    };
+
+    // Queues the values from each Observable, for the zip that takes an Array
+    template<typename Function>
+    class ZipCombiner : public Impl::Combiner
+    {
+    public:
+        ZipCombiner(size_t numObservables, const Function& function)
+        : queues(numObservables),
+          completed(numObservables, false),
+          numEmptyQueues(numObservables),
+          completedAndEmpty(numObservables == 0),
+          function(function)
+        {}
+
+        bool onNext(size_t index, const any& value, any& result) override
+        {
+            auto& queue = queues[index];
+            if (queue.empty())
+                --numEmptyQueues;
+
+            queue.push_back(value.get<T>());
+            if (numEmptyQueues > 0)
+                return false;
+
+            juce::Array<T> values;
+            values.ensureStorageAllocated(static_cast<int>(queues.size()));
+            for (size_t i = 0; i < queues.size(); ++i) {
+                values.add(std::move(queues[i].front()));
+                queues[i].pop_front();
+
+                if (queues[i].empty()) {
+                    ++numEmptyQueues;
+                    completedAndEmpty = completedAndEmpty || completed[i];
+                }
+            }
+
+            result = toAny(function(static_cast<const juce::Array<T>&>(values)));
+            return true;
+        }
+
+        void onCompleted(size_t index) override
+        {
+            completed[index] = true;
+            completedAndEmpty = completedAndEmpty || queues[index].empty();
+        }
+
+        bool isCompleted() const override
+        {
+            return completedAndEmpty;
+        }
+
+    private:
+        std::vector<std::deque<T>> queues;
+        std::vector<bool> completed;
+        size_t numEmptyQueues;
+        bool completedAndEmpty;
+        Function function;
+    };
+
     // any_args<Ts...>::type is a parameter pack with the same length as Ts, where all types are any.
     template<typename>
     struct any_args
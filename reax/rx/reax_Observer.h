@@ -36,6 +36,15 @@ public:
         impl.onCompleted();
     }
 
+    /**
+     Creates an Observer that calls `onNext` for each new value.
+     
+     This is cheaper than creating a Subject and subscribing to it, if you just need an Observer that does something with each value. onCompleted is ignored, and onError terminates the app (like Observable::subscribe without an onError function).
+     */
+    explicit Observer(const std::function<void(const T&)>& onNext)
+    : Observer(detail::ObserverImpl::fromFunction([onNext](const detail::any& value) { onNext(value.get<T>()); }))
+    {}
+
     /// Contravariant constructor: If T is convertible to U, an Observer<U> is convertible to an Observer<T>. 
     template<typename U>
     Observer(const Observer<U>& other, typename std::enable_if<std::is_convertible<T, U>::value>::type* = 0)
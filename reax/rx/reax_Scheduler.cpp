@@ -2,7 +2,8 @@ namespace {
     using namespace juce;
 
     // A Rx dispatcher for the JUCE message thread. It processes Observables that are observed on it.
-    class JUCEDispatcher : private Timer
+    // Scheduling an action posts a single (coalesced) message to the message thread. A timer is only used to wait for delayed actions.
+    class JUCEDispatcher : private AsyncUpdater, private Timer
     {
     public:
         JUCEDispatcher()
@@ -11,7 +12,10 @@ namespace {
             // The run loop didn't get initialized! Please report this as a bug.
             jassert(runLoop);
 
-            startTimerHz(60);
+            // Called on the scheduling thread, whenever an action is scheduled that's due before all other scheduled actions.
+            runLoop->set_notify_earlier_wakeup([this](const rxcpp::schedulers::run_loop::clock_type::time_point&) {
+                triggerAsyncUpdate();
+            });
         }
 
         rxcpp::observe_on_one_worker createWorker() const
@@ -41,11 +45,359 @@ namespace {
             return rl;
         }
 
+        void handleAsyncUpdate() override
+        {
+            dispatchDueActions();
+        }
+
         void timerCallback() override
         {
-            // Run any scheduled actions
-            while (!runLoop->empty() && runLoop->peek().when < runLoop->now())
+            dispatchDueActions();
+        }
+
+        void dispatchDueActions()
+        {
+            // Run any scheduled actions that are due
+            while (!runLoop->empty() && runLoop->peek().when <= runLoop->now()) {
+                REAX_TRACE_SCOPE("Scheduler::messageThread dispatch");
                 runLoop->dispatch();
+            }
+
+            // If the run loop is empty, the next scheduled action triggers an async update
+            if (runLoop->empty()) {
+                stopTimer();
+                return;
+            }
+
+            // Wait for the next delayed action
+            const auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(runLoop->peek().when - runLoop->now());
+            startTimer(jmax(1, static_cast<int>(delay.count())));
+        }
+    };
+
+    // A fixed-size pool of threads, used by Scheduler::threadPool.
+    //
+    // Each Rx worker (observeOn creates one per subscription) is a Strand: A FIFO queue of actions that run one at a time, so the values of a subscription stay in order.
+    // A Strand that has pending actions is queued on the deque of one of the pool threads. A thread takes Strands from the back of its own deque, and steals from the front of the other threads' deques if its own deque is empty.
+    class ThreadPool : public rxcpp::schedulers::scheduler_interface
+    {
+        typedef rxcpp::schedulers::schedulable Action;
+        struct State;
+
+        class Strand : public rxcpp::schedulers::detail::worker_interface
+        {
+        public:
+            explicit Strand(const std::shared_ptr<State>& state)
+            : state(state)
+            {}
+
+            clock_type::time_point now() const override
+            {
+                return clock_type::now();
+            }
+
+            void schedule(const Action& action) const override
+            {
+                enqueue(action);
+            }
+
+            void schedule(clock_type::time_point when, const Action& action) const override
+            {
+                if (when > now())
+                    state->scheduleDelayed(when, sharedThis(), action);
+                else
+                    enqueue(action);
+            }
+
+            void enqueue(const Action& action) const
+            {
+                REAX_CHECK_REALTIME_SAFE("Scheduling an action on Scheduler::threadPool");
+
+                bool wasIdle = false;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    actions.push_back(action);
+                    wasIdle = !isQueued;
+                    isQueued = true;
+                }
+
+                // Only queue the Strand if it's not already queued or running, so that its actions never run concurrently
+                if (wasIdle)
+                    state->push(sharedThis());
+            }
+
+            // Runs some of the pending actions. Returns true if there are actions left.
+            bool run() const
+            {
+                for (int i = 0; i < MaxActionsPerRun; ++i) {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    if (actions.empty()) {
+                        isQueued = false;
+                        return false;
+                    }
+
+                    const Action action = actions.front();
+                    actions.pop_front();
+                    lock.unlock();
+
+                    if (action.is_subscribed()) {
+                        // Don't let the action recurse, so it can't hog a pool thread
+                        rxcpp::schedulers::recursion recursion;
+                        recursion.reset(false);
+                        REAX_TRACE_SCOPE("Scheduler::threadPool dispatch");
+                        action(recursion.get_recurse());
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                isQueued = !actions.empty();
+                return isQueued;
+            }
+
+            // Releases the pending actions. They hold the worker, and the worker holds this Strand.
+            void clear() const
+            {
+                std::deque<Action> released;
+                std::lock_guard<std::mutex> lock(mutex);
+                released.swap(actions);
+            }
+
+        private:
+            static const int MaxActionsPerRun = 64;
+
+            const std::shared_ptr<State> state;
+            mutable std::mutex mutex;
+            mutable std::deque<Action> actions;
+            mutable bool isQueued = false;
+
+            std::shared_ptr<const Strand> sharedThis() const
+            {
+                return std::static_pointer_cast<const Strand>(shared_from_this());
+            }
+        };
+
+        typedef std::shared_ptr<const Strand> Strand_ptr;
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Strand_ptr> strands;
+        };
+
+        struct DelayedAction
+        {
+            clock_type::time_point when;
+            uint64 sequenceNumber;
+            Strand_ptr strand;
+            Action action;
+
+            // For the priority queue: The earliest action (and for equal times, the first one scheduled) is at the top
+            bool operator<(const DelayedAction& other) const
+            {
+                return std::tie(when, sequenceNumber) > std::tie(other.when, other.sequenceNumber);
+            }
+        };
+
+        struct State
+        {
+            explicit State(size_t numThreads)
+            : queues(numThreads)
+            {}
+
+            std::vector<Queue> queues;
+            std::vector<std::thread> threads;
+            std::atomic<size_t> numQueued{ 0 };
+            std::atomic<size_t> nextQueue{ 0 };
+            std::atomic<bool> shouldExit{ false };
+
+            // Guards sleeping and the delayed actions
+            std::mutex mutex;
+            std::condition_variable wakeUp;
+            std::priority_queue<DelayedAction> delayedActions;
+            uint64 nextSequenceNumber = 0;
+
+            int indexOfCurrentThread() const
+            {
+                const auto currentThread = std::this_thread::get_id();
+                for (size_t i = 0; i < threads.size(); ++i) {
+                    if (threads[i].get_id() == currentThread)
+                        return static_cast<int>(i);
+                }
+
+                return -1;
+            }
+
+            // Queues a Strand on the current pool thread, or (if called from another thread) on the pool threads in turn
+            void push(const Strand_ptr& strand)
+            {
+                const int currentIndex = indexOfCurrentThread();
+                const size_t index = (currentIndex >= 0 ? static_cast<size_t>(currentIndex) : nextQueue++ % queues.size());
+                {
+                    std::lock_guard<std::mutex> lock(queues[index].mutex);
+                    queues[index].strands.push_back(strand);
+                }
+
+                ++numQueued;
+                notify();
+            }
+
+            // Queues a Strand that still has actions after a run. It goes to the front, so other Strands get their turn first.
+            void requeue(size_t index, const Strand_ptr& strand)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(queues[index].mutex);
+                    queues[index].strands.push_front(strand);
+                }
+
+                ++numQueued;
+                notify();
+            }
+
+            Strand_ptr take(size_t index)
+            {
+                for (size_t i = 0; i < queues.size(); ++i) {
+                    auto& queue = queues[(index + i) % queues.size()];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    if (queue.strands.empty())
+                        continue;
+
+                    // Take the most recently queued Strand from the own deque, but steal the oldest Strand from other deques
+                    Strand_ptr strand;
+                    if (i == 0) {
+                        strand = queue.strands.back();
+                        queue.strands.pop_back();
+                    }
+                    else {
+                        strand = queue.strands.front();
+                        queue.strands.pop_front();
+                    }
+
+                    --numQueued;
+                    return strand;
+                }
+
+                return nullptr;
+            }
+
+            void scheduleDelayed(clock_type::time_point when, const Strand_ptr& strand, const Action& action)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    delayedActions.push(DelayedAction{ when, nextSequenceNumber++, strand, action });
+                }
+
+                // A sleeping thread may need to wake up earlier now
+                wakeUp.notify_one();
+            }
+
+            void enqueueDueDelayedActions()
+            {
+                std::vector<DelayedAction> dueActions;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    const auto now = clock_type::now();
+                    while (!delayedActions.empty() && delayedActions.top().when <= now) {
+                        dueActions.push_back(delayedActions.top());
+                        delayedActions.pop();
+                    }
+                }
+
+                for (auto& dueAction : dueActions)
+                    dueAction.strand->enqueue(dueAction.action);
+            }
+
+            void notify()
+            {
+                // Lock the mutex, so a thread that's about to sleep doesn't miss the notification
+                { std::lock_guard<std::mutex> lock(mutex); }
+                wakeUp.notify_one();
+            }
+
+            void runThread(size_t index)
+            {
+                while (!shouldExit) {
+                    enqueueDueDelayedActions();
+
+                    if (const auto strand = take(index)) {
+                        if (strand->run())
+                            requeue(index, strand);
+
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock(mutex);
+                    if (numQueued > 0 || shouldExit)
+                        continue;
+
+                    if (delayedActions.empty())
+                        wakeUp.wait(lock);
+                    else
+                        wakeUp.wait_until(lock, delayedActions.top().when);
+                }
+            }
+        };
+
+        const std::shared_ptr<State> state;
+
+    public:
+        explicit ThreadPool(size_t numThreads)
+        : state(std::make_shared<State>(numThreads))
+        {
+            state->threads.reserve(numThreads);
+            for (size_t i = 0; i < numThreads; ++i) {
+                // The thread keeps the state alive, in case it's detached (see below)
+                const auto threadState = state;
+                state->threads.emplace_back([threadState, i]() { threadState->runThread(i); });
+            }
+        }
+
+        ~ThreadPool()
+        {
+            state->shouldExit = true;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->wakeUp.notify_all();
+            }
+
+            for (auto& thread : state->threads) {
+                // The pool may be destroyed by one of its own actions
+                if (thread.get_id() == std::this_thread::get_id())
+                    thread.detach();
+                else
+                    thread.join();
+            }
+
+            // Break the reference cycles of actions that never ran
+            for (auto& queue : state->queues) {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                for (auto& strand : queue.strands)
+                    strand->clear();
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            while (!state->delayedActions.empty()) {
+                state->delayedActions.top().strand->clear();
+                state->delayedActions.pop();
+            }
+        }
+
+        clock_type::time_point now() const override
+        {
+            return clock_type::now();
+        }
+
+        rxcpp::schedulers::worker create_worker(rxcpp::composite_subscription lifetime) const override
+        {
+            const auto strand = std::make_shared<Strand>(state);
+
+            // Release pending actions when the subscription ends
+            const std::weak_ptr<Strand> weakStrand(strand);
+            lifetime.add([weakStrand]() {
+                if (const auto strand = weakStrand.lock())
+                    strand->clear();
+            });
+
+            return rxcpp::schedulers::worker(lifetime, strand);
         }
     };
 }
@@ -75,3 +427,12 @@ Scheduler Scheduler::newThread()
         return observable.observe_on(rxcpp::serialize_new_thread());
     });
 }
+
+Scheduler Scheduler::threadPool(unsigned int numThreads)
+{
+    const auto numPoolThreads = (numThreads > 0 ? numThreads : static_cast<unsigned int>(jmax(1, SystemStats::getNumCpus())));
+    const auto coordination = rxcpp::observe_on_one_worker(rxcpp::schedulers::make_scheduler<ThreadPool>(numPoolThreads));
+    return std::make_shared<detail::SchedulerImpl>([coordination](const rxcpp::observable<detail::any>& observable) {
+        return observable.observe_on(coordination);
+    });
+}
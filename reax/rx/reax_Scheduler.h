@@ -7,14 +7,14 @@ namespace detail {
 /**
     A Scheduler is used to process parts of an Observable on a specific thread.
  
-    Use the Scheduler::messageThread, Scheduler::backgroundThread and Scheduler::newThread member functions and pass the returned Scheduler to Observable::observeOn.
+    Use the Scheduler::messageThread, Scheduler::backgroundThread, Scheduler::newThread and Scheduler::threadPool member functions and pass the returned Scheduler to Observable::observeOn.
  
     @see Observable::observeOn
  */
 class Scheduler
 {
 public:
-    /// The JUCE message thread. 
+    /// The JUCE message thread. Values are delivered with the next message loop iteration, without polling.
     static Scheduler messageThread();
 
     /// A shared background thread. Use this if you don't want to block the message thread, but don't want to spawn a new thread either. The thread is shared between Observables. 
@@ -23,6 +23,13 @@ public:
     /// Makes the Observable spawn a new thread. 
     static Scheduler newThread();
 
+    /**
+        A new pool of `numThreads` threads (pass 0 to use one thread per CPU core). Use this if you observe many Observables off the message thread: Values of each subscription are processed in order, but different subscriptions run in parallel on the pool's threads.
+     
+        The pool's threads exit when the returned Scheduler and all Observables that use it are destroyed. So create one pool and share it, instead of calling this for each Observable.
+     */
+    static Scheduler threadPool(unsigned int numThreads = 0);
+
 private:
     template<typename T>
     friend class Observable;
@@ -37,7 +37,11 @@ public:
     : Subject<T>(detail::SubjectImpl::MakeBehaviorSubjectImpl(detail::any(initial)))
     {}
 
-    /// Returns the most recently emitted value. If no values have been emitted, it returns the initial value. 
+    /**
+     Returns the most recently emitted value. If no values have been emitted, it returns the initial value.
+     
+     Doesn't lock and doesn't wait, so it can be called from any thread, even while another thread pushes a new value. For polling from a realtime thread, use a value type that doesn't allocate when it's copied.
+     */
     T getValue() const
     {
         return Subject<T>::impl.getValue().template get<T>();
@@ -78,7 +82,9 @@ public:
     /**
      Creates a new instance.
      
-     The `bufferSize` is the maximum number of values to remember and replay. Defaults to remembering "all" values (within memory boundaries). The buffer size is increased as values are emitted (not allocated upfront).
+     The `bufferSize` is the maximum number of values to remember and replay. Defaults to remembering "all" values (within memory boundaries). In this case, the buffer size is increased as values are emitted (not allocated upfront).
+     
+     If you pass a `bufferSize`, the buffer is allocated once, and each new value overwrites the oldest value when it's full. So the memory usage doesn't grow over time, e.g. when keeping a history of values in a long session.
      */
     explicit ReplaySubject(size_t bufferSize = std::numeric_limits<size_t>::max())
     : Subject<T>(detail::SubjectImpl::MakeReplaySubjectImpl(bufferSize))
@@ -0,0 +1,171 @@
+#pragma once
+
+/**
+ A chain of operators that runs without type erasure. Use it for hot paths (e.g. metering) where the per-value cost of a regular Observable chain matters.
+
+ Each operator on a regular Observable converts every value to and from an internal dynamic type, and calls the operator's function through a `std::function`. A TypedObservable instead composes its operators at compile time, so a value passes through the whole chain in a single, inlinable function call. The value is only converted once: When it leaves the TypedObservable, i.e. when you subscribe to it or convert it back into an Observable.
+
+ Get a TypedObservable by calling Observable::typed:
+
+     Observable<float> levels = meterSource.typed()
+         .map([](float level) { return Decibels::gainToDecibels(level); })
+         .filter([](float dB) { return dB > -60.f; })
+         .distinctUntilChanged();
+
+ The type of a TypedObservable depends on the functions passed to its operators, so use `auto` if you want to store it in a local variable. To store it as a member, convert it to an Observable.
+
+ Stateful operators (like TypedObservable::scan) keep their state per subscription, just like the equivalent Observable operators.
+ */
+template<typename T, typename Pipeline>
+class TypedObservable
+{
+    typedef typename Pipeline::InputType InputType;
+    typedef detail::ObservableImpl Impl;
+    typedef detail::any any;
+
+    template<typename Stage>
+    using Next = TypedObservable<typename Stage::ValueType, Stage>;
+
+public:
+    /// The type of values emitted by this TypedObservable.
+    typedef T ValueType;
+
+#pragma mark - Operators
+    /**
+     For each emitted value, calls the function with that value and emits the result.
+
+     @see Observable::map
+     */
+    template<typename Function>
+    Next<detail::MapStage<Pipeline, typename std::decay<Function>::type>> map(Function&& function) const
+    {
+        return makeNext(detail::MapStage<Pipeline, typename std::decay<Function>::type>{ pipeline, std::forward<Function>(function) });
+    }
+
+    /**
+     Emits only those values that pass a predicate function.
+
+     @see Observable::filter
+     */
+    template<typename Predicate>
+    Next<detail::FilterStage<Pipeline, typename std::decay<Predicate>::type>> filter(Predicate&& predicate) const
+    {
+        return makeNext(detail::FilterStage<Pipeline, typename std::decay<Predicate>::type>{ pipeline, std::forward<Predicate>(predicate) });
+    }
+
+    /**
+     Calls `f` with the accumulator (initially `startValue`) and each emitted value, and emits the result. The result becomes the new accumulator.
+
+     @see Observable::scan
+     */
+    template<typename U, typename Function>
+    Next<detail::ScanStage<Pipeline, U, typename std::decay<Function>::type>> scan(const U& startValue, Function&& f) const
+    {
+        return makeNext(detail::ScanStage<Pipeline, U, typename std::decay<Function>::type>{ pipeline, startValue, std::forward<Function>(f) });
+    }
+
+    ///@{
+    /**
+     Suppresses consecutive duplicate values. Values are compared using `operator==`, or the given `equals` function.
+
+     @see Observable::distinctUntilChanged
+     */
+    Next<detail::DistinctUntilChangedStage<Pipeline, std::equal_to<T>>> distinctUntilChanged() const
+    {
+        return distinctUntilChanged(std::equal_to<T>());
+    }
+
+    template<typename Equals>
+    Next<detail::DistinctUntilChangedStage<Pipeline, typename std::decay<Equals>::type>> distinctUntilChanged(Equals&& equals) const
+    {
+        return makeNext(detail::DistinctUntilChangedStage<Pipeline, typename std::decay<Equals>::type>(pipeline, std::forward<Equals>(equals)));
+    }
+    ///@}
+
+    /**
+     Suppresses the first `numValues` values.
+
+     @see Observable::skip
+     */
+    Next<detail::SkipStage<Pipeline>> skip(unsigned int numValues) const
+    {
+        return makeNext(detail::SkipStage<Pipeline>{ pipeline, numValues });
+    }
+
+
+#pragma mark - Conversion
+    /**
+     Converts this TypedObservable into a regular Observable.
+
+     This is the only place where values are converted to the internal dynamic type: Once per value that leaves the chain.
+     */
+    Observable<T> asObservable() const
+    {
+        const Pipeline prototype(pipeline);
+
+        return source.lift([prototype]() {
+            // Each subscription gets its own copy of the pipeline (and its state)
+            Pipeline subscriptionPipeline(prototype);
+
+            return Impl::Transform([subscriptionPipeline](const any& value, any& result) mutable {
+                bool emitted = false;
+                EmitToResult emit{ result, emitted };
+                subscriptionPipeline(value.get<InputType>(), emit);
+
+                return emitted;
+            });
+        }, "typed");
+    }
+
+    /// Converts this TypedObservable into a regular Observable. @see TypedObservable::asObservable
+    operator Observable<T>() const
+    {
+        return asObservable();
+    }
+
+    /**
+     Subscribes to the values emitted at the end of the chain. @see Observable::subscribe
+     */
+    Subscription subscribe(const std::function<void(const T&)>& onNext,
+                           const std::function<void(std::exception_ptr)>& onError = Impl::TerminateOnError,
+                           const std::function<void()>& onCompleted = Impl::EmptyOnCompleted) const
+    {
+        return asObservable().subscribe(onNext, onError, onCompleted);
+    }
+
+private:
+    template<typename U>
+    friend class Observable;
+    template<typename U, typename P>
+    friend class TypedObservable;
+
+    // The Observable that emits the values at the start of the pipeline
+    Impl source;
+    Pipeline pipeline;
+
+    TypedObservable(const Impl& source, const Pipeline& pipeline)
+    : source(source),
+      pipeline(pipeline)
+    {}
+
+    template<typename Stage>
+    Next<Stage> makeNext(Stage&& stage) const
+    {
+        return Next<Stage>(source, std::forward<Stage>(stage));
+    }
+
+    // Converts the value at the end of the pipeline (if any) to the result of the Transform
+    struct EmitToResult
+    {
+        any& result;
+        bool& emitted;
+
+        void operator()(const T& value) const
+        {
+            result = Observable<T>::toAny(value);
+            emitted = true;
+        }
+    };
+
+    JUCE_LEAK_DETECTOR(TypedObservable)
+};
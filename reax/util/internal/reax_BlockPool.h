@@ -0,0 +1,78 @@
+#pragma once
+
+namespace detail {
+/*
+ A fixed set of preallocated buffers for BlockViews. Used by LockFreeBlockSource.
+
+ A buffer is free if the pool holds the only reference to it, i.e. no BlockView of it exists anymore. Taking a free buffer doesn't lock or allocate, and may be done from several threads at the same time.
+ */
+template<typename T>
+class BlockPool
+{
+public:
+    BlockPool(size_t numBuffers, size_t maxBlockSize)
+    : maxBlockSize(maxBlockSize)
+    {
+        buffers.ensureStorageAllocated(static_cast<int>(numBuffers));
+        for (size_t i = 0; i < numBuffers; ++i)
+            buffers.add(new Buffer(maxBlockSize));
+    }
+
+    size_t getMaxBlockSize() const
+    {
+        return maxBlockSize;
+    }
+
+    // Copies the values into a free buffer, and returns a BlockView of it. If no buffer is free, it allocates a new buffer if allowAllocation is true. Otherwise, it returns an empty BlockView.
+    BlockView<T> write(const T* values, size_t numValues, bool allowAllocation)
+    {
+        // Must not write more than maxBlockSize values at once
+        jassert(numValues <= maxBlockSize);
+
+        for (auto buffer : buffers) {
+            if (buffer->getReferenceCount() != 1)
+                continue;
+
+            // Claim the buffer, so that no other producer takes it at the same time
+            bool wasClaimed = false;
+            if (!buffer->isClaimed.compare_exchange_strong(wasClaimed, true, std::memory_order_acquire))
+                continue;
+
+            // Check again: Another producer may have taken the buffer before it was claimed
+            if (buffer->getReferenceCount() != 1) {
+                buffer->isClaimed.store(false, std::memory_order_release);
+                continue;
+            }
+
+            std::copy(values, values + numValues, buffer->values.begin());
+            const BlockView<T> block(buffer->values.data(), numValues, buffer);
+            buffer->isClaimed.store(false, std::memory_order_release);
+            return block;
+        }
+
+        if (!allowAllocation)
+            return BlockView<T>();
+
+        // All buffers are in use. Allocate a buffer that isn't added to the pool:
+        return BlockView<T>::copyOf(values, numValues);
+    }
+
+private:
+    struct Buffer : public juce::ReferenceCountedObject
+    {
+        explicit Buffer(size_t size)
+        : values(size)
+        {}
+
+        std::vector<T> values;
+        std::atomic<bool> isClaimed{ false };
+    };
+
+    const size_t maxBlockSize;
+
+    // Not modified after construction
+    juce::ReferenceCountedArray<Buffer> buffers;
+
+    JUCE_DECLARE_NON_COPYABLE(BlockPool)
+};
+}
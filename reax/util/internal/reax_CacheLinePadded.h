@@ -0,0 +1,14 @@
+#pragma once
+
+namespace detail {
+/*
+ Puts a value on its own cache line(s), so that a thread writing it doesn't slow down threads that access neighbouring data (false sharing).
+ */
+template<typename T>
+struct CacheLinePadded
+{
+    char paddingBefore[REAX_CACHE_LINE_SIZE];
+    T value;
+    char paddingAfter[REAX_CACHE_LINE_SIZE - sizeof(T) % REAX_CACHE_LINE_SIZE];
+};
+}
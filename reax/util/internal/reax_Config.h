@@ -0,0 +1,67 @@
+#pragma once
+
+// Module configuration flags. Define these in your AppConfig.h (or via the Projucer's preprocessor definitions) to override the defaults.
+
+/** Config: REAX_ANY_INLINE_STORAGE_SIZE
+ 
+ The size (in bytes) of the inline storage in each value that flows through an Observable. Objects up to this size that are nothrow-move-constructible, copy-constructible and have operator== are stored inline, without allocating dynamic memory. Larger objects are allocated on the heap.
+ */
+#ifndef REAX_ANY_INLINE_STORAGE_SIZE
+#define REAX_ANY_INLINE_STORAGE_SIZE 32
+#endif
+
+static_assert(REAX_ANY_INLINE_STORAGE_SIZE > 0, "REAX_ANY_INLINE_STORAGE_SIZE must be > 0.");
+
+/** Config: REAX_CACHE_LINE_SIZE
+ 
+ The size (in bytes) of a CPU cache line. Lock-free buffers that are shared between threads (e.g. in LockFreeSource) pad the data that's written by different threads to this size, so that the threads don't slow each other down by writing to the same cache line.
+ */
+#ifndef REAX_CACHE_LINE_SIZE
+#define REAX_CACHE_LINE_SIZE 64
+#endif
+
+/** Config: REAX_ENABLE_INSTRUMENTATION
+ 
+ If enabled, each Observable operator records how many values it receives and emits, how much time is spent in the functions passed to it, and how many subscribers it has. Use Observable::named to tell your chains apart, and Instrumentation::getSnapshot to read the counters. This adds some overhead to each value, so it's disabled by default.
+ */
+#ifndef REAX_ENABLE_INSTRUMENTATION
+#define REAX_ENABLE_INSTRUMENTATION 0
+#endif
+
+/** Config: REAX_ENABLE_TRACING
+ 
+ If enabled, ReaX records trace events into a preallocated ring buffer per thread: The functions passed to Observable operators, the values that are enqueued into and emitted from a LockFreeSource, and the actions that are dispatched by a Scheduler. Recording is wait-free and doesn't allocate memory, so it's safe on the audio thread. Call Tracing::writeChromeTrace to save the events as a file that you can open in Perfetto or chrome://tracing. Disabled by default.
+ */
+#ifndef REAX_ENABLE_TRACING
+#define REAX_ENABLE_TRACING 0
+#endif
+
+/** Config: REAX_TRACE_BUFFER_SIZE
+ 
+ The number of trace events that are kept for each thread, if REAX_ENABLE_TRACING is enabled. When a thread's buffer is full, its oldest events are overwritten.
+ 
+ The buffers are static, and each event takes about 32 bytes, so tracing reserves about REAX_TRACE_MAX_THREADS * REAX_TRACE_BUFFER_SIZE * 32 bytes (2 MB by default).
+ */
+#ifndef REAX_TRACE_BUFFER_SIZE
+#define REAX_TRACE_BUFFER_SIZE 4096
+#endif
+
+static_assert(REAX_TRACE_BUFFER_SIZE > 0, "REAX_TRACE_BUFFER_SIZE must be > 0.");
+
+/** Config: REAX_TRACE_MAX_THREADS
+ 
+ The number of threads that can record trace events at the same time, if REAX_ENABLE_TRACING is enabled. Events of additional threads are ignored.
+ */
+#ifndef REAX_TRACE_MAX_THREADS
+#define REAX_TRACE_MAX_THREADS 16
+#endif
+
+static_assert(REAX_TRACE_MAX_THREADS > 0, "REAX_TRACE_MAX_THREADS must be > 0.");
+
+/** Config: REAX_ENABLE_REALTIME_CHECKS
+ 
+ If enabled, ReaX reports when it does something that isn't realtime-safe (allocating memory, locking a mutex, boxing a large value, or calling Observer::onNext) on a thread that's marked with a ScopedRealtimeThread. By default, it logs a message and triggers an assertion. Useful in debug builds, disabled by default.
+ */
+#ifndef REAX_ENABLE_REALTIME_CHECKS
+#define REAX_ENABLE_REALTIME_CHECKS 0
+#endif
@@ -0,0 +1,79 @@
+namespace detail {
+void LockFreeSourceStatisticsRecorder::setEnabled(bool shouldBeEnabled, const juce::RelativeTime& snapshotInterval)
+{
+    // Must be called on the message thread
+    jassert(MessageManager::getInstance()->isThisTheMessageThread());
+
+    enabled.store(shouldBeEnabled, std::memory_order_relaxed);
+
+    if (shouldBeEnabled && snapshotInterval.inMilliseconds() > 0)
+        startTimer(static_cast<int>(snapshotInterval.inMilliseconds()));
+    else
+        stopTimer();
+}
+
+void LockFreeSourceStatisticsRecorder::valueEnqueued(size_t queueSize) noexcept
+{
+    numEnqueued.fetch_add(1, std::memory_order_relaxed);
+
+    size_t previousMaximum = highWaterMark.load(std::memory_order_relaxed);
+    while (queueSize > previousMaximum && !highWaterMark.compare_exchange_weak(previousMaximum, queueSize, std::memory_order_relaxed)) {}
+}
+
+void LockFreeSourceStatisticsRecorder::valuesDropped(juce::int64 numValues) noexcept
+{
+    numDropped.fetch_add(numValues, std::memory_order_relaxed);
+}
+
+void LockFreeSourceStatisticsRecorder::untaggedValueEnqueued(juce::int64 ticks) noexcept
+{
+    juce::int64 oldest = oldestUntaggedTicks.load(std::memory_order_relaxed);
+    while ((oldest == 0 || ticks < oldest) && !oldestUntaggedTicks.compare_exchange_weak(oldest, ticks, std::memory_order_relaxed)) {}
+}
+
+void LockFreeSourceStatisticsRecorder::valueEmitted(juce::int64 enqueueTicks, juce::int64 nowTicks) noexcept
+{
+    ++numEmitted;
+
+    // The value was enqueued before statistics were enabled
+    if (enqueueTicks == 0)
+        return;
+
+    // The bucket is the position of the highest set bit of the latency in microseconds
+    auto microseconds = static_cast<juce::uint64>(jmax(0.0, Time::highResolutionTicksToSeconds(nowTicks - enqueueTicks) * 1e6));
+    size_t bucket = 0;
+    while (microseconds > 1 && bucket + 1 < latencyHistogram.size()) {
+        microseconds >>= 1;
+        ++bucket;
+    }
+
+    ++latencyHistogram[bucket];
+}
+
+LockFreeSourceStatistics LockFreeSourceStatisticsRecorder::getSnapshot() const
+{
+    LockFreeSourceStatistics statistics;
+    statistics.numEnqueued = numEnqueued.load(std::memory_order_relaxed);
+    statistics.numDropped = numDropped.load(std::memory_order_relaxed);
+    statistics.numEmitted = numEmitted;
+    statistics.highWaterMark = highWaterMark.load(std::memory_order_relaxed);
+    statistics.latencyHistogram = latencyHistogram;
+
+    return statistics;
+}
+
+void LockFreeSourceStatisticsRecorder::reset()
+{
+    numEnqueued.store(0, std::memory_order_relaxed);
+    numDropped.store(0, std::memory_order_relaxed);
+    highWaterMark.store(0, std::memory_order_relaxed);
+    oldestUntaggedTicks.store(0, std::memory_order_relaxed);
+    numEmitted = 0;
+    latencyHistogram.fill(0);
+}
+
+void LockFreeSourceStatisticsRecorder::timerCallback()
+{
+    snapshots.onNext(getSnapshot());
+}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+namespace detail {
+/*
+ Records the statistics of a LockFreeSource, if they are enabled.
+ 
+ The producer side (valueEnqueued, valuesDropped, untaggedValueEnqueued) is lock-free and doesn't allocate memory, and may be called from several threads at once. Everything else is only called on the message thread.
+ */
+class LockFreeSourceStatisticsRecorder : private juce::Timer
+{
+public:
+    LockFreeSourceStatisticsRecorder() = default;
+
+    bool isEnabled() const noexcept
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    // Returns the current time for valueEmitted, or 0 if statistics are disabled
+    juce::int64 getTimestamp() const noexcept
+    {
+        return (isEnabled() ? juce::Time::getHighResolutionTicks() : 0);
+    }
+
+    void setEnabled(bool shouldBeEnabled, const juce::RelativeTime& snapshotInterval);
+
+    // Producer side. The queueSize is the number of values in the queue after enqueueing.
+    void valueEnqueued(size_t queueSize) noexcept;
+    void valuesDropped(juce::int64 numValues) noexcept;
+
+    // For values in a queue that can't store their timestamps: Remembers the timestamp of the oldest one
+    void untaggedValueEnqueued(juce::int64 ticks) noexcept;
+
+    // Message thread. Returns the timestamp of the oldest untagged value (or 0), and forgets it.
+    juce::int64 takeOldestUntaggedTimestamp() noexcept
+    {
+        return oldestUntaggedTicks.exchange(0, std::memory_order_relaxed);
+    }
+
+    // Message thread. The enqueueTicks is the timestamp of the value (or 0 if it's unknown).
+    void valueEmitted(juce::int64 enqueueTicks, juce::int64 nowTicks) noexcept;
+
+    LockFreeSourceStatistics getSnapshot() const;
+    void reset();
+
+    PublishSubject<LockFreeSourceStatistics> snapshots;
+
+private:
+    std::atomic<bool> enabled{ false };
+    std::atomic<juce::int64> numEnqueued{ 0 };
+    std::atomic<juce::int64> numDropped{ 0 };
+    std::atomic<size_t> highWaterMark{ 0 };
+    std::atomic<juce::int64> oldestUntaggedTicks{ 0 };
+
+    // Only used on the message thread
+    juce::int64 numEmitted = 0;
+    std::array<juce::int64, LockFreeSourceStatistics::NumLatencyBuckets> latencyHistogram{ {} };
+
+    void timerCallback() override;
+
+    JUCE_DECLARE_NON_COPYABLE(LockFreeSourceStatisticsRecorder)
+};
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace detail {
+// Returns true if the calling thread is inside a ScopedRealtimeThread. Wait-free.
+bool isRealtimeThread() noexcept;
+
+// Calls the violation handler of ScopedRealtimeThread
+void reportRealtimeViolation(const char* operation);
+
+inline void checkRealtimeSafe(const char* operation)
+{
+    if (isRealtimeThread())
+        reportRealtimeViolation(operation);
+}
+}
+
+// Reports the operation if it's done on a realtime thread. Pass a description like "Locking a mutex in Foo::bar".
+#if REAX_ENABLE_REALTIME_CHECKS
+#define REAX_CHECK_REALTIME_SAFE(operation) detail::checkRealtimeSafe(operation)
+#else
+#define REAX_CHECK_REALTIME_SAFE(operation) static_cast<void>(0)
+#endif
@@ -0,0 +1,153 @@
+#pragma once
+
+namespace detail {
+/*
+ A bounded, lock-free queue for exactly one producer thread and one consumer thread.
+
+ It's a ring buffer with a power-of-two number of slots. All slots are allocated (and filled with copies of a dummy value) on construction, so enqueueing never allocates memory, unless assigning a T does. The producer is wait-free.
+
+ Each slot has a sequence number, which tells whether the slot holds the value at a given position: A slot for position p is free if its sequence is p, and holds the value for p if its sequence is p + 1. The consumer takes a value by advancing `head`. When dropping the oldest value, the producer advances `head` instead.
+
+ Each value can carry a tag (e.g. the time when it was enqueued), which is stored next to it in the slot.
+ */
+template<typename T>
+class SingleProducerQueue
+{
+public:
+    SingleProducerQueue(size_t minCapacity, const T& dummy)
+    : capacity(roundUpToPowerOfTwo(minCapacity)),
+      mask(capacity - 1),
+      slots(capacity)
+    {
+        head.value = 0;
+        tail.value = 0;
+
+        for (size_t i = 0; i < capacity; ++i)
+            new (slots + i) Slot(i, dummy);
+    }
+
+    ~SingleProducerQueue()
+    {
+        for (size_t i = 0; i < capacity; ++i)
+            slots[i].~Slot();
+    }
+
+    size_t getCapacity() const
+    {
+        return capacity;
+    }
+
+    // Producer only. Returns the number of values in the queue, which may be decreased by the consumer at the same time.
+    size_t getSize() const
+    {
+        return static_cast<size_t>(tail.value - head.value.load(std::memory_order_acquire));
+    }
+
+    // Producer only. Returns false if the queue is full. Only moves from value if it returns true.
+    template<typename U>
+    bool tryEnqueue(U&& value, juce::int64 tag = 0)
+    {
+        Slot& slot = slots[tail.value & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != tail.value)
+            return false;
+
+        write(slot, std::forward<U>(value), tag);
+        return true;
+    }
+
+    // Producer only. If the queue is full, drops the oldest value to make room for the new value, and sets hasDroppedOldest (if given).
+    // Returns false if the new value was dropped instead. This only happens if the consumer is taking the oldest value at the same time (so the queue is about to have room again).
+    template<typename U>
+    bool enqueueDroppingOldest(U&& value, juce::int64 tag = 0, bool* hasDroppedOldest = nullptr)
+    {
+        Slot& slot = slots[tail.value & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != tail.value) {
+            // The queue is full, so the slot holds the oldest value. Claim it from the consumer:
+            juce::uint64 oldest = tail.value - capacity;
+            if (!head.value.compare_exchange_strong(oldest, oldest + 1, std::memory_order_acq_rel))
+                return false;
+
+            if (hasDroppedOldest)
+                *hasDroppedOldest = true;
+        }
+
+        write(slot, std::forward<U>(value), tag);
+        return true;
+    }
+
+    // Consumer only. Returns false if the queue is empty. Sets the tag of the value, if given.
+    template<typename U>
+    bool tryDequeue(U& value, juce::int64* tag = nullptr)
+    {
+        juce::uint64 position = head.value.load(std::memory_order_acquire);
+        for (;;) {
+            Slot& slot = slots[position & mask];
+            const auto difference = static_cast<juce::int64>(slot.sequence.load(std::memory_order_acquire) - (position + 1));
+
+            // The slot doesn't hold a value yet
+            if (difference < 0)
+                return false;
+
+            // The producer has dropped this value (and written newer values since then)
+            if (difference > 0) {
+                position = head.value.load(std::memory_order_acquire);
+                continue;
+            }
+
+            // On failure, the producer has dropped this value. Try again with the updated position.
+            if (head.value.compare_exchange_weak(position, position + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                value = std::move(slot.value);
+                if (tag)
+                    *tag = slot.tag;
+
+                slot.sequence.store(position + capacity, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+private:
+    struct Slot
+    {
+        Slot(juce::uint64 sequence, const T& dummy)
+        : sequence(sequence),
+          value(dummy)
+        {}
+
+        std::atomic<juce::uint64> sequence;
+        T value;
+        juce::int64 tag = 0;
+    };
+
+    // Read-only after construction
+    const size_t capacity;
+    const size_t mask;
+    juce::HeapBlock<Slot> slots;
+
+    // Written by the consumer, and by the producer when it drops the oldest value
+    CacheLinePadded<std::atomic<juce::uint64>> head;
+
+    // Only used by the producer
+    CacheLinePadded<juce::uint64> tail;
+
+    template<typename U>
+    void write(Slot& slot, U&& value, juce::int64 tag)
+    {
+        slot.value = std::forward<U>(value);
+        slot.tag = tag;
+        slot.sequence.store(tail.value + 1, std::memory_order_release);
+        ++tail.value;
+    }
+
+    static size_t roundUpToPowerOfTwo(size_t minCapacity)
+    {
+        size_t capacity = 1;
+        while (capacity < minCapacity)
+            capacity *= 2;
+
+        return capacity;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE(SingleProducerQueue)
+};
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#if REAX_ENABLE_TRACING
+namespace detail {
+// The phases of the Chrome trace event format
+enum class TracePhase : char {
+    Begin = 'B',
+    End = 'E',
+    Instant = 'i'
+};
+
+// Appends an event to the calling thread's trace buffer. Wait-free and doesn't allocate memory.
+// The name must stay valid until the app exits: Pass a string literal, or a name returned from internTraceName. The count is exported if it's >= 0.
+void addTraceEvent(const char* name, TracePhase phase, juce::int64 count = -1) noexcept;
+
+// Returns a copy of the name that stays valid until the app exits. Locks and may allocate memory, so don't call this on the audio thread.
+const char* internTraceName(const juce::String& name);
+
+// Records a Begin event on construction and an End event on destruction
+class ScopedTraceEvent
+{
+public:
+    explicit ScopedTraceEvent(const char* name) noexcept
+    : name(name)
+    {
+        addTraceEvent(name, TracePhase::Begin);
+    }
+
+    ~ScopedTraceEvent()
+    {
+        addTraceEvent(name, TracePhase::End);
+    }
+
+private:
+    const char* const name;
+
+    JUCE_DECLARE_NON_COPYABLE(ScopedTraceEvent)
+};
+}
+
+#define REAX_TRACE_SCOPE(name) const detail::ScopedTraceEvent JUCE_JOIN_MACRO(reaxTraceEvent, __LINE__)(name)
+#define REAX_TRACE_INSTANT(name, count) detail::addTraceEvent(name, detail::TracePhase::Instant, count)
+#else
+#define REAX_TRACE_SCOPE(name) static_cast<void>(0)
+#define REAX_TRACE_INSTANT(name, count) static_cast<void>(0)
+#endif
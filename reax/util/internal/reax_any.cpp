@@ -1,26 +1,31 @@
 namespace detail {
 any::any(int value)
 : type(Type::Int),
+  inlineFunctions(nullptr),
   intValue(value)
 {}
 
 any::any(int64 value)
 : type(Type::Int64),
+  inlineFunctions(nullptr),
   int64Value(value)
 {}
 
 any::any(bool value)
 : type(Type::Bool),
+  inlineFunctions(nullptr),
   boolValue(value)
 {}
 
 any::any(float value)
 : type(Type::Float),
+  inlineFunctions(nullptr),
   floatValue(value)
 {}
 
 any::any(double value)
 : type(Type::Double),
+  inlineFunctions(nullptr),
   doubleValue(value)
 {}
 
@@ -44,14 +49,16 @@ bool any::equals(const any& other) const
             return (other.type == Type::Enum && enumValue == other.enumValue);
         case Type::RawPointer:
             return (other.type == Type::RawPointer && rawPointerValue == other.rawPointerValue);
+        case Type::InlineObject:
+            return (other.type == Type::InlineObject && inlineFunctions == other.inlineFunctions && inlineFunctions->equals(&inlineValue, &other.inlineValue));
         case Type::Object:
-            return objectValue->equals(*other.objectValue);
+            return (other.type == Type::Object && objectValue->equals(*other.objectValue));
     }
 }
 
 bool any::isArithmetic() const
 {
-    return (type != Type::Enum && type != Type::RawPointer && type != Type::Object);
+    return (type != Type::Enum && type != Type::RawPointer && type != Type::InlineObject && type != Type::Object);
 }
 
 std::string any::getTypeName() const
@@ -71,12 +78,15 @@ std::string any::getTypeName() const
             return "raw pointer";
         case Type::Enum:
             return "enum";
+        case Type::InlineObject:
+            return inlineFunctions->typeName();
         case Type::Object:
             return objectValue->typeInfo.name();
     }
 }
 
-any::Object::Object(const std::type_info& typeInfo)
-: typeInfo(typeInfo)
+any::Object::Object(TypeId typeId, const std::type_info& typeInfo)
+: typeId(typeId),
+  typeInfo(typeInfo)
 {}
 }
@@ -6,6 +6,8 @@ namespace detail {
  
  The type of the held value is erased. So to extract the held value (using `any::get()`), you have to provide the exact type of the held value. No base-class, of it, but the exact type it was constructed from. If in doubt, use `static_cast` before passing the value to the `any` constructor, to ensure that it's stored as a certain type.
  
+ Small objects are stored inline, without allocating dynamic memory (see `REAX_ANY_INLINE_STORAGE_SIZE`). This is done for types that fit into the inline storage, are nothrow-move-constructible, copy-constructible and equality-comparable. Other objects are allocated on the heap and shared by reference between copies of the `any`.
+ 
  Two `any` instances are equality-comparable. If an instance `a` is compared to an instance `b` as in `a == b`, and both hold a scalar value (e.g. int, float, bool), the scalar values are converted and compared. So `var(1.f) == var(1)`. If both hold an object, it casts `b` to the type of `a`. If that succeeds, it compares them using `a`'s `operator==`. If `a` is not equality-comparable, it checks if the addresses of the wrapped values in `a` and `b` are equal. This may be false if both `a` and `b` were contructed from the same value, because the value may have been copied when constructing. Otherwise, `a` and `b` are considered to be non-equal.
  
  This class is used to create a dynamic layer between the type-safe `reax::Observable` and the type-safe `rxcpp::observable`.
@@ -13,6 +15,30 @@ namespace detail {
 ///@cond INTERNAL
 class any
 {
+    // The inline storage for small objects. It's part of the same union as the scalar values, so scalars don't need any extra space.
+    typedef std::aligned_storage<REAX_ANY_INLINE_STORAGE_SIZE>::type InlineStorage;
+
+    // Checks if T has operator==
+    template<typename T>
+    using HasEqualityOperator = typename std::enable_if<true, decltype(std::declval<T&>() == std::declval<T&>(), (void)0)>::type;
+
+    template<typename T, typename Enable = void>
+    struct IsEqualityComparable : std::false_type
+    {};
+
+    template<typename T>
+    struct IsEqualityComparable<T, HasEqualityOperator<T>> : std::true_type
+    {};
+
+    // Checks whether a T is stored in the inline storage. Only types that are compared by value are stored inline, so that copying the any doesn't change the result of equals().
+    template<typename T, bool IsCandidate = (std::is_class<T>::value && !std::is_base_of<any, T>::value)>
+    struct StoredInline : std::false_type
+    {};
+
+    template<typename T>
+    struct StoredInline<T, true> : std::integral_constant<bool, (sizeof(T) <= sizeof(InlineStorage) && alignof(T) <= alignof(InlineStorage) && std::is_nothrow_move_constructible<T>::value && std::is_copy_constructible<T>::value && IsEqualityComparable<T>::value)>
+    {};
+
 public:
     ///@{
     /**
@@ -40,16 +66,21 @@ public:
     template<typename T>
     using is_any = std::is_base_of<any, typename std::decay<T>::type>;
 
+    template<typename T>
+    using is_stored_inline = StoredInline<typename std::decay<T>::type>;
+
 
     template<typename T>
     explicit any(T&& value, typename std::enable_if<is_enum<T>::value>::type* = 0)
     : type(Type::Enum),
+      inlineFunctions(nullptr),
       enumValue(static_cast<juce::int64>(value))
     {}
 
     template<typename T>
     explicit any(T&& value, typename std::enable_if<is_pointer<T>::value>::type* = 0)
     : type(Type::RawPointer),
+      inlineFunctions(nullptr),
       rawPointerValue(value)
     {}
 
@@ -59,19 +90,76 @@ public:
      If you use this constructor, make sure that the value you're passing in actually has the type that you try to `get<T>()` later on. One way to ensure this is to use `any(static_cast<T>(myT))`.
      */
     template<typename T>
-    explicit any(T&& value, typename std::enable_if<is_class<T>::value && !is_any<T>::value>::type* = 0)
+    explicit any(T&& value, typename std::enable_if<is_class<T>::value && !is_any<T>::value && !is_stored_inline<T>::value>::type* = 0)
     : type(Type::Object),
+      inlineFunctions(nullptr),
       objectValue(std::make_shared<EquatableTypedObject<typename std::decay<T>::type>>(std::forward<T>(value)))
-    {}
+    {
+        REAX_CHECK_REALTIME_SAFE("Boxing a value on the heap (it doesn't fit into the inline storage)");
+    }
 
-    /// Default move constructor
-    any(any&&) = default;
+    template<typename T>
+    explicit any(T&& value, typename std::enable_if<is_stored_inline<T>::value>::type* = 0)
+    : type(Type::InlineObject),
+      inlineFunctions(&InlineObject<typename std::decay<T>::type>::functions)
+    {
+        new (&inlineValue) typename std::decay<T>::type(std::forward<T>(value));
+    }
 
-    /// Default copy constructor. If the wrapped value is scalar, it is copied. Otherwise, it is shared by reference.
-    any(const any&) = default;
+    /// Move constructor
+    any(any&& other) noexcept
+    : type(other.type),
+      inlineFunctions(other.inlineFunctions),
+      objectValue(std::move(other.objectValue))
+    {
+        if (type == Type::InlineObject)
+            inlineFunctions->move(&other.inlineValue, &inlineValue);
+        else
+            std::memcpy(&inlineValue, &other.inlineValue, sizeof(inlineValue));
+    }
 
-    /// Default copy assignment operator. If the wrapped value is scalar, it is copied. Otherwise, it is shared by reference.
-    any& operator=(const any&) = default;
+    /// Copy constructor. If the wrapped value is scalar or stored inline, it is copied. Otherwise, it is shared by reference.
+    any(const any& other)
+    : type(other.type),
+      inlineFunctions(other.inlineFunctions),
+      objectValue(other.objectValue)
+    {
+        if (type == Type::InlineObject)
+            inlineFunctions->copy(&other.inlineValue, &inlineValue);
+        else
+            std::memcpy(&inlineValue, &other.inlineValue, sizeof(inlineValue));
+    }
+
+    /// Move assignment operator.
+    any& operator=(any&& other) noexcept
+    {
+        if (this != &other) {
+            destroyInlineValue();
+
+            type = other.type;
+            inlineFunctions = other.inlineFunctions;
+            objectValue = std::move(other.objectValue);
+
+            if (type == Type::InlineObject)
+                inlineFunctions->move(&other.inlineValue, &inlineValue);
+            else
+                std::memcpy(&inlineValue, &other.inlineValue, sizeof(inlineValue));
+        }
+
+        return *this;
+    }
+
+    /// Copy assignment operator. If the wrapped value is scalar or stored inline, it is copied. Otherwise, it is shared by reference.
+    any& operator=(const any& other)
+    {
+        // Copy first, so this instance is untouched if copying throws
+        return (*this = any(other));
+    }
+
+    ~any()
+    {
+        destroyInlineValue();
+    }
 
     ///@{
     /**
@@ -129,7 +217,7 @@ public:
         if (!is<T>())
             throw typeMismatchError<T>();
 
-        return getObjectPointer<T>()->t;
+        return getObject<T>(is_stored_inline<T>());
     }
     ///@}
 
@@ -157,7 +245,7 @@ public:
     template<typename T>
     bool is(typename std::enable_if<is_class<T>::value>::type* = 0) const
     {
-        return (getObjectPointer<T>() != nullptr);
+        return isObject<T>(is_stored_inline<T>());
     }
 
     /**
@@ -170,33 +258,45 @@ public:
     bool equals(const any& other) const;
 
 private:
+    // Identifies a type without RTTI. Each T has its own static token, so checking the type of a held object is a single pointer comparison. The token is not const, so the linker can't merge the tokens of different types.
+    typedef const void* TypeId;
+
+    template<typename T>
+    struct TypeToken
+    {
+        static char token;
+    };
+
+    template<typename T>
+    static TypeId typeIdOf()
+    {
+        return &TypeToken<T>::token;
+    }
+
     // Type-erased wrapper
     struct Object
     {
-        Object(const std::type_info& typeInfo);
+        Object(TypeId typeId, const std::type_info& typeInfo);
         virtual ~Object() {}
         virtual bool equals(const Object& other) const = 0;
 
+        const TypeId typeId;
         const std::type_info& typeInfo;
     };
 
-    // Object subclass that is also a T. It inherits from T to make this work: any(Derived()).get<Base>();
+    // Object subclass that holds a T.
     template<typename T>
     struct TypedObject : Object
     {
         template<typename U>
         TypedObject(U&& value)
-        : Object(typeid(U)),
+        : Object(typeIdOf<T>(), typeid(T)),
           t(std::forward<U>(value))
         {}
 
         T t;
     };
 
-    // Checks if T has operator==
-    template<typename T>
-    using HasEqualityOperator = typename std::enable_if<true, decltype(std::declval<T&>() == std::declval<T&>(), (void)0)>::type;
-
     // Implements the equals() function using pointer comparison
     template<typename T, typename Enable = void>
     struct EquatableTypedObject : TypedObject<T>
@@ -205,8 +305,8 @@ private:
 
         bool equals(const Object& other) const override
         {
-            // Compare by address. dynamic_cast<void*> downcasts to the most derived class, so if this and other are the same instance, the expression is true.
-            return (dynamic_cast<const void*>(this) == dynamic_cast<const void*>(&other));
+            // Compare by address
+            return (static_cast<const Object*>(this) == &other);
         }
     };
 
@@ -219,8 +319,8 @@ private:
         bool equals(const Object& other) const override
         {
             // If other contains a T, compare them:
-            if (auto ptr = dynamic_cast<const EquatableTypedObject<T>*>(&other))
-                return (TypedObject<T>::t == ptr->t);
+            if (other.typeId == Object::typeId)
+                return (TypedObject<T>::t == static_cast<const EquatableTypedObject<T>&>(other).t);
 
             // other does not contain a T, so the objects can't be equal
             else
@@ -228,6 +328,48 @@ private:
         }
     };
 
+    // Copies, moves, destroys and compares a T that is stored in the inline storage. There's one static instance per T.
+    struct InlineObjectFunctions
+    {
+        TypeId typeId;
+        void (*copy)(const void* source, void* destination);
+        void (*move)(void* source, void* destination);
+        void (*destroy)(void* object);
+        bool (*equals)(const void* lhs, const void* rhs);
+        const char* (*typeName)();
+    };
+
+    template<typename T>
+    struct InlineObject
+    {
+        static void copy(const void* source, void* destination)
+        {
+            new (destination) T(*static_cast<const T*>(source));
+        }
+
+        static void move(void* source, void* destination)
+        {
+            new (destination) T(std::move(*static_cast<T*>(source)));
+        }
+
+        static void destroy(void* object)
+        {
+            static_cast<T*>(object)->~T();
+        }
+
+        static bool equals(const void* lhs, const void* rhs)
+        {
+            return (*static_cast<const T*>(lhs) == *static_cast<const T*>(rhs));
+        }
+
+        static const char* typeName()
+        {
+            return typeid(T).name();
+        }
+
+        static const InlineObjectFunctions functions;
+    };
+
     // The type of the held value. Needed to use the correct member of the union.
     enum class Type {
         Int,
@@ -237,12 +379,16 @@ private:
         Double,
         RawPointer,
         Enum,
+        InlineObject,
         Object
     };
 
     Type type;
 
-    // The held value, if it's scalar (including enums).
+    // The functions to handle the inline object, if type is Type::InlineObject.
+    const InlineObjectFunctions* inlineFunctions;
+
+    // The held value, if it's scalar (including enums) or a small object.
     union
     {
         int intValue;
@@ -252,9 +398,10 @@ private:
         double doubleValue;
         void* rawPointerValue;
         juce::int64 enumValue;
+        InlineStorage inlineValue;
     };
 
-    // The held value, if it's non-scalar.
+    // The held value, if it's a non-scalar that is not stored inline.
     std::shared_ptr<Object> objectValue;
 
     template<typename T>
@@ -267,7 +414,40 @@ private:
     template<typename T>
     const TypedObject<T>* getObjectPointer() const
     {
-        return std::dynamic_pointer_cast<const TypedObject<T>>(objectValue).get();
+        if (type == Type::Object && objectValue->typeId == typeIdOf<T>())
+            return static_cast<const TypedObject<T>*>(objectValue.get());
+
+        return nullptr;
+    }
+
+    template<typename T>
+    const T& getObject(std::true_type /* stored inline */) const
+    {
+        return *static_cast<const T*>(static_cast<const void*>(&inlineValue));
+    }
+
+    template<typename T>
+    const T& getObject(std::false_type /* stored inline */) const
+    {
+        return getObjectPointer<T>()->t;
+    }
+
+    template<typename T>
+    bool isObject(std::true_type /* stored inline */) const
+    {
+        return (type == Type::InlineObject && inlineFunctions->typeId == typeIdOf<T>());
+    }
+
+    template<typename T>
+    bool isObject(std::false_type /* stored inline */) const
+    {
+        return (getObjectPointer<T>() != nullptr);
+    }
+
+    void destroyInlineValue()
+    {
+        if (type == Type::InlineObject)
+            inlineFunctions->destroy(&inlineValue);
     }
 
     bool isArithmetic() const;
@@ -278,6 +458,19 @@ private:
 };
 ///@endcond
 
+template<typename T>
+char any::TypeToken<T>::token = 0;
+
+template<typename T>
+const any::InlineObjectFunctions any::InlineObject<T>::functions = {
+    &any::TypeToken<T>::token,
+    &any::InlineObject<T>::copy,
+    &any::InlineObject<T>::move,
+    &any::InlineObject<T>::destroy,
+    &any::InlineObject<T>::equals,
+    &any::InlineObject<T>::typeName
+};
+
 inline bool operator==(const any& lhs, const any& rhs)
 {
     return lhs.equals(rhs);
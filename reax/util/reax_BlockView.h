@@ -0,0 +1,80 @@
+#pragma once
+
+/**
+ A read-only view of a contiguous block of values, e.g. a block of audio samples. Emitted by LockFreeBlockSource.
+ 
+ A BlockView keeps its memory alive: Copying a BlockView doesn't copy the values, it only increments a reference count. So BlockViews can be passed through an Observable chain cheaply, with one emitted value per block.
+ 
+ @see LockFreeBlockSource
+ */
+template<typename T>
+class BlockView
+{
+public:
+    /// Creates an empty BlockView.
+    BlockView()
+    : data(nullptr),
+      numValues(0)
+    {}
+
+    /// Creates a BlockView of `numValues` values at `data`. The `owner` must keep the values alive, and must not modify them while this BlockView exists.
+    BlockView(const T* data, size_t numValues, juce::ReferenceCountedObject* owner)
+    : owner(owner),
+      data(data),
+      numValues(numValues)
+    {}
+
+    /// Creates a BlockView with a copy of the given values. Allocates memory.
+    static BlockView<T> copyOf(const T* values, size_t numValues)
+    {
+        const juce::ReferenceCountedObjectPtr<Storage> storage(new Storage(values, numValues));
+        return BlockView<T>(storage->values.data(), numValues, storage.get());
+    }
+
+    /// Returns a pointer to the first value.
+    const T* getData() const { return data; }
+
+    /// Returns the number of values.
+    size_t size() const { return numValues; }
+
+    /// Returns true if the BlockView has no values.
+    bool isEmpty() const { return numValues == 0; }
+
+    /// Returns the value at the given index.
+    const T& operator[](size_t index) const
+    {
+        jassert(index < numValues);
+        return data[index];
+    }
+
+    ///@{
+    /// Iterators, for range-based for loops.
+    const T* begin() const { return data; }
+    const T* end() const { return data + numValues; }
+    ///@}
+
+    /// Compares the values of two BlockViews.
+    bool operator==(const BlockView<T>& other) const
+    {
+        return numValues == other.numValues && (data == other.data || std::equal(begin(), end(), other.begin()));
+    }
+
+    bool operator!=(const BlockView<T>& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    struct Storage : public juce::ReferenceCountedObject
+    {
+        Storage(const T* values, size_t numValues)
+        : values(values, values + numValues)
+        {}
+
+        const std::vector<T> values;
+    };
+
+    juce::ReferenceCountedObjectPtr<juce::ReferenceCountedObject> owner;
+    const T* data;
+    size_t numValues;
+};
@@ -24,12 +24,26 @@ enum class CongestionPolicy {
     DropOldest
 };
 
+/**
+ Determines which threads may call LockFreeSource::onNext.
+ 
+ MultipleProducers: onNext() may be called from several threads at the same time. Uses a multi-producer queue, which allocates memory the first time each thread calls onNext(). To avoid this on a realtime thread, call onNext() once from each producer thread before it becomes realtime-critical (e.g. in prepareToPlay).
+ 
+ SingleProducer: onNext() is only called from one thread at a time (typically the audio thread). Uses a preallocated ring buffer: onNext() is wait-free and doesn't allocate memory, except with CongestionPolicy::Allocate when the ring buffer is full.
+ */
+enum class ProducerPolicy {
+    MultipleProducers,
+    SingleProducer
+};
+
 /**
  An Observable that receives values from a realtime thread (like the audio thread) and emits those values on the JUCE message thread.
  
  The value type must be copy-constructible or (preferably) move-constructible.
  
  Call asObservable() to get the Observable, subscribe to it, etc. Then call LockFreeSource::onNext on the realtime thread to emit values.
+ 
+ If only one thread calls onNext, pass ProducerPolicy::SingleProducer to the constructor. @see ProducerPolicy
  */
 template<typename T>
 class LockFreeSource : private detail::LockFreeSourceBase<T>, private juce::AsyncUpdater, public Observable<T>
@@ -41,12 +55,34 @@ public:
      The queueCapacity must be > 0. If you have to use CongestionPolicy::Allocate, use a large capacity, to make dynamic allocation on the audio thread as unlikely as possible. **The given `queueCapacity` may get rounded up to a different value.**
      */
     explicit LockFreeSource(size_t queueCapacity, const T& dummy = T())
+    : LockFreeSource(queueCapacity, ProducerPolicy::MultipleProducers, dummy)
+    {}
+
+    /**
+     Creates a new instance with the given ProducerPolicy.
+     
+     With ProducerPolicy::SingleProducer, the `queueCapacity` is rounded up to the next power of two.
+     */
+    LockFreeSource(size_t queueCapacity, ProducerPolicy producerPolicy, const T& dummy = T())
     : Observable<T>(detail::LockFreeSourceBase<T>::subject),
-      queue(queueCapacity),
-      dummy(dummy)
+      queue(producerPolicy == ProducerPolicy::SingleProducer ? 0 : queueCapacity),
+      ringBuffer(producerPolicy == ProducerPolicy::SingleProducer ? new detail::SingleProducerQueue<T>(queueCapacity, dummy) : nullptr),
+      dummy(dummy),
+      batchSize(juce::jlimit<size_t>(1, MaxBatchSize, queueCapacity)),
+      batch(batchSize),
+      batchTicks(batchSize)
     {
         // The queue capacity must be > 0.
         jassert(queueCapacity > 0);
+
+        for (size_t i = 0; i < batchSize; ++i)
+            new (batch + i) T(dummy);
+    }
+
+    ~LockFreeSource()
+    {
+        for (size_t i = 0; i < batchSize; ++i)
+            batch[i].~T();
     }
 
     ///@{
@@ -66,19 +102,137 @@ public:
     }
     ///@}
 
+    /**
+     Limits how much work is done in each message thread callback, so that a burst of values (e.g. after a transport jump) doesn't block the message thread for a whole frame.
+     
+     If a limit is reached and there are more values in the queue, the remaining values are emitted in the next callback. The duration is checked after each batch of values, so it may be exceeded by the time it takes to emit a few values.
+     
+     Pass 0 (or a zero RelativeTime) to remove a limit. By default, there are no limits and all values are emitted in one callback.
+     
+     Must be called on the message thread.
+     */
+    void setDrainBudget(int maxValuesPerCallback, const juce::RelativeTime& maxDurationPerCallback = juce::RelativeTime())
+    {
+        // The limits must be >= 0.
+        jassert(maxValuesPerCallback >= 0 && maxDurationPerCallback.inSeconds() >= 0);
+
+        maxValuesPerDrain = static_cast<size_t>(juce::jmax(0, maxValuesPerCallback));
+        maxTicksPerDrain = juce::Time::secondsToHighResolutionTicks(juce::jmax(0.0, maxDurationPerCallback.inSeconds()));
+    }
+
+    /**
+     Starts or stops collecting statistics: How many values have been enqueued, dropped and emitted, how full the queue got, and how long the values waited in the queue. @see LockFreeSourceStatistics
+     
+     While statistics are enabled, onNext gets the current time and updates a few atomic counters, so it stays lock-free and doesn't allocate memory. The statistics() Observable emits a snapshot every `snapshotInterval` (pass a zero RelativeTime to disable the snapshots).
+     
+     With ProducerPolicy::SingleProducer, the latency is measured for each value. Otherwise (and for values that didn't fit into the ring buffer), the queue can't store a timestamp with each value, so each value counts with the latency of the oldest value that was emitted in the same callback.
+     
+     Statistics are disabled by default. Must be called on the message thread.
+     */
+    void setStatisticsEnabled(bool shouldBeEnabled, const juce::RelativeTime& snapshotInterval = juce::RelativeTime::seconds(1))
+    {
+        statisticsRecorder.setEnabled(shouldBeEnabled, snapshotInterval);
+    }
+
+    /// Returns the statistics since they were enabled or reset. Must be called on the message thread.
+    LockFreeSourceStatistics getStatistics() const
+    {
+        return statisticsRecorder.getSnapshot();
+    }
+
+    /// Sets all statistics to zero. Must be called on the message thread.
+    void resetStatistics()
+    {
+        statisticsRecorder.reset();
+    }
+
+    /// Emits a snapshot of the statistics periodically on the message thread, while statistics are enabled. @see setStatisticsEnabled
+    Observable<LockFreeSourceStatistics> statistics() const
+    {
+        return statisticsRecorder.snapshots;
+    }
+
 private:
+    // With ProducerPolicy::SingleProducer, this only holds the values that didn't fit into the ring buffer (with CongestionPolicy::Allocate). It's only used with enqueue, which allocates anyway, so it doesn't preallocate any blocks.
     moodycamel::ConcurrentQueue<T> queue;
+    const std::unique_ptr<detail::SingleProducerQueue<T>> ringBuffer;
+    std::atomic<size_t> numOverflowValues{ 0 };
     T dummy;
 
+    // Values are dequeued in batches into this preallocated buffer, before they are emitted. It's not a std::vector, because std::vector<bool> has no bool& elements.
+    static const size_t MaxBatchSize = 64;
+    const size_t batchSize;
+    juce::HeapBlock<T> batch;
+
+    // The enqueue time of each value in the batch (only if statistics are enabled)
+    std::vector<juce::int64> batchTicks;
+
+    // LockFreeBlockSource records the blocks that it drops because no preallocated buffer is free
+    template<typename> friend class LockFreeBlockSource;
+    detail::LockFreeSourceStatisticsRecorder statisticsRecorder;
+
+    // Only used on the message thread. 0 means no limit.
+    size_t maxValuesPerDrain = 0;
+    juce::int64 maxTicksPerDrain = 0;
+
+#if REAX_ENABLE_REALTIME_CHECKS
+    // The multi-producer queue allocates an implicit producer the first time a thread enqueues. These are the threads that have already enqueued.
+    static const size_t MaxKnownProducers = 16;
+    std::atomic<juce::Thread::ThreadID> knownProducers[MaxKnownProducers] {};
+
+    // Reports the first onNext from each thread. If there are more producer threads than can be remembered, every onNext from the other threads is reported.
+    void checkProducerThread()
+    {
+        const auto currentThread = juce::Thread::getCurrentThreadId();
+        for (auto& knownProducer : knownProducers) {
+            auto thread = knownProducer.load(std::memory_order_acquire);
+            if (thread == currentThread)
+                return;
+
+            if (thread == nullptr && knownProducer.compare_exchange_strong(thread, currentThread))
+                break;
+
+            // Another thread may have claimed the slot in the meantime
+            if (thread == currentThread)
+                return;
+        }
+
+        REAX_CHECK_REALTIME_SAFE("Calling LockFreeSource::onNext from a new thread (ProducerPolicy::MultipleProducers)");
+    }
+#endif
+
     template<typename U>
     void _onNext(U&& value, CongestionPolicy congestionPolicy)
     {
+        const auto ticks = statisticsRecorder.getTimestamp();
+
+        if (ringBuffer) {
+            if (enqueueSingleProducer(std::forward<U>(value), congestionPolicy, ticks)) {
+                REAX_TRACE_INSTANT("LockFreeSource::onNext", -1);
+                triggerAsyncUpdate();
+            }
+            else
+                REAX_TRACE_INSTANT("LockFreeSource::onNext (dropped)", -1);
+
+            return;
+        }
+
+#if REAX_ENABLE_REALTIME_CHECKS
+        checkProducerThread();
+#endif
+
         bool needsUpdate = false;
+        juce::int64 numDropped = 0;
         
         switch (congestionPolicy) {
             // If allocation is allowed, just enqueue the value, allowing the queue to allocate memory if needed.
+            // Try without allocating first, so that an allocation on a realtime thread can be reported. try_enqueue only moves from the value if it succeeds.
             case CongestionPolicy::Allocate:
-                queue.enqueue(std::forward<U>(value));
+                if (!queue.try_enqueue(std::forward<U>(value))) {
+                    REAX_CHECK_REALTIME_SAFE("Allocating memory in LockFreeSource::onNext (CongestionPolicy::Allocate)");
+                    queue.enqueue(std::forward<U>(value));
+                }
+
                 needsUpdate = true;
                 break;
 
@@ -98,26 +252,258 @@ private:
                 
                 // Queue is full. Drop values from the front until there's space again:
                 T unused(dummy);
-                while (!queue.try_enqueue(value))
-                    queue.try_dequeue(unused);
+                while (!queue.try_enqueue(value)) {
+                    if (queue.try_dequeue(unused))
+                        ++numDropped;
+                }
                 
                 needsUpdate = true;
                 break;
             }
         }
 
+        if (statisticsRecorder.isEnabled()) {
+            if (needsUpdate) {
+                statisticsRecorder.untaggedValueEnqueued(ticks);
+                statisticsRecorder.valueEnqueued(queue.size_approx());
+            }
+            else
+                numDropped = 1;
+
+            if (numDropped > 0)
+                statisticsRecorder.valuesDropped(numDropped);
+        }
+
         // Trigger an update on the message thread, if needed
-        if (needsUpdate)
+        if (needsUpdate) {
+            REAX_TRACE_INSTANT("LockFreeSource::onNext", -1);
             triggerAsyncUpdate();
+        }
+        else
+            REAX_TRACE_INSTANT("LockFreeSource::onNext (dropped)", -1);
+    }
+
+    // Returns true if the value has been enqueued. The ticks are stored with the value in the ring buffer.
+    template<typename U>
+    bool enqueueSingleProducer(U&& value, CongestionPolicy congestionPolicy, juce::int64 ticks)
+    {
+        // To keep the order of values, the ring buffer counts as full while there are values in the overflow queue
+        const bool hasOverflowValues = (numOverflowValues.load(std::memory_order_acquire) > 0);
+        bool hasEnqueued = false;
+        bool hasDroppedOldest = false;
+
+        switch (congestionPolicy) {
+            // If the ring buffer is full, put the value into the overflow queue, allowing it to allocate memory.
+            // tryEnqueue only moves from the value if it succeeds, so it's safe to forward it again below.
+            case CongestionPolicy::Allocate:
+                if (!hasOverflowValues && ringBuffer->tryEnqueue(std::forward<U>(value), ticks)) {
+                    hasEnqueued = true;
+                    break;
+                }
+
+                REAX_CHECK_REALTIME_SAFE("Allocating memory in LockFreeSource::onNext (CongestionPolicy::Allocate)");
+
+                // Increment before enqueueing, so the counter is never lower than the number of values in the overflow queue
+                ++numOverflowValues;
+                queue.enqueue(std::forward<U>(value));
+                if (statisticsRecorder.isEnabled())
+                    statisticsRecorder.untaggedValueEnqueued(ticks);
+
+                hasEnqueued = true;
+                break;
+
+            case CongestionPolicy::DropNewest:
+                hasEnqueued = (!hasOverflowValues && ringBuffer->tryEnqueue(std::forward<U>(value), ticks));
+                break;
+
+            // The oldest values may be in the overflow queue, which can only be dequeued on the message thread. In this case, drop the new value instead.
+            case CongestionPolicy::DropOldest:
+                hasEnqueued = (!hasOverflowValues && ringBuffer->enqueueDroppingOldest(std::forward<U>(value), ticks, &hasDroppedOldest));
+                break;
+        }
+
+        if (statisticsRecorder.isEnabled()) {
+            if (hasEnqueued)
+                statisticsRecorder.valueEnqueued(ringBuffer->getSize() + numOverflowValues.load(std::memory_order_relaxed));
+
+            if (!hasEnqueued || hasDroppedOldest)
+                statisticsRecorder.valuesDropped(1);
+        }
+
+        return hasEnqueued;
+    }
+
+    // Dequeues up to maxValues values into the batch buffer, and their enqueue times into batchTicks. Returns the number of dequeued values.
+    // The values from the overflow queue don't have their own enqueue times, so they get the untaggedTicks.
+    size_t tryDequeueBatch(size_t maxValues, juce::int64 untaggedTicks)
+    {
+        if (!ringBuffer)
+            return fillBatchTicks(queue.try_dequeue_bulk(batch.get(), maxValues), untaggedTicks);
+
+        // Values in the ring buffer are always older than the values in the overflow queue
+        size_t numValues = 0;
+        while (numValues < maxValues && ringBuffer->tryDequeue(batch[numValues], &batchTicks[numValues]))
+            ++numValues;
+
+        if (numValues > 0)
+            return numValues;
+
+        numValues = queue.try_dequeue_bulk(batch.get(), maxValues);
+        numOverflowValues -= numValues;
+        return fillBatchTicks(numValues, untaggedTicks);
+    }
+
+    size_t fillBatchTicks(size_t numValues, juce::int64 ticks)
+    {
+        std::fill(batchTicks.begin(), batchTicks.begin() + static_cast<std::ptrdiff_t>(numValues), ticks);
+        return numValues;
     }
 
     void handleAsyncUpdate() override
     {
-        // Emits all values from the queue
-        T value(dummy);
-        while (queue.try_dequeue(value))
-            detail::LockFreeSourceBase<T>::subject.onNext(value);
+        REAX_TRACE_SCOPE("LockFreeSource::handleAsyncUpdate");
+
+        // Emits the values from the queue, until it's empty or the drain budget is used up
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        const bool recordsStatistics = statisticsRecorder.isEnabled();
+        const auto untaggedTicks = (recordsStatistics ? statisticsRecorder.takeOldestUntaggedTimestamp() : 0);
+        size_t numEmitted = 0;
+
+        for (;;) {
+            // The budget is checked before each batch, and not only after it, because a subscriber may have lowered it below numEmitted
+            const bool reachedMaxValues = (maxValuesPerDrain > 0 && numEmitted >= maxValuesPerDrain);
+            const bool reachedMaxDuration = (numEmitted > 0 && maxTicksPerDrain > 0 && juce::Time::getHighResolutionTicks() - startTicks >= maxTicksPerDrain);
+            if (reachedMaxValues || reachedMaxDuration) {
+                // Emit the remaining values (if any) in the next callback
+                if (untaggedTicks != 0)
+                    statisticsRecorder.untaggedValueEnqueued(untaggedTicks);
+
+                triggerAsyncUpdate();
+                return;
+            }
+
+            const size_t maxValues = (maxValuesPerDrain > 0 ? juce::jmin(batchSize, maxValuesPerDrain - numEmitted) : batchSize);
+            const size_t numValues = tryDequeueBatch(maxValues, untaggedTicks);
+            if (numValues == 0)
+                return;
+
+            REAX_TRACE_INSTANT("LockFreeSource dequeue", static_cast<juce::int64>(numValues));
+
+            if (recordsStatistics) {
+                const auto nowTicks = juce::Time::getHighResolutionTicks();
+                for (size_t i = 0; i < numValues; ++i)
+                    statisticsRecorder.valueEmitted(batchTicks[i], nowTicks);
+            }
+
+            // Reset each emitted value, so the batch buffer doesn't keep it (e.g. a pooled BlockView) alive
+            for (size_t i = 0; i < numValues; ++i) {
+                detail::LockFreeSourceBase<T>::subject.onNext(batch[i]);
+                batch[i] = dummy;
+            }
+
+            numEmitted += numValues;
+        }
     }
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LockFreeSource)
 };
+
+namespace detail {
+template<typename T>
+class LockFreeBlockSourceBase
+{
+protected:
+    LockFreeBlockSourceBase(size_t maxBlockSize, size_t queueCapacity, ProducerPolicy producerPolicy)
+    : source(queueCapacity, producerPolicy),
+      pool(queueCapacity + NumBlocksInUse, maxBlockSize)
+    {}
+
+    // Blocks that may be in use outside of the queue: The one that's currently being emitted, and one that's kept by a subscriber
+    static const size_t NumBlocksInUse = 2;
+
+    LockFreeSource<BlockView<T>> source;
+    BlockPool<T> pool;
+};
+}
+
+/**
+ A LockFreeSource for blocks of values, e.g. audio samples for a meter or an oscilloscope.
+ 
+ Instead of calling onNext for each value, you call LockFreeBlockSource::onNextBatch with a whole block of values on the realtime thread. The values are copied into a preallocated buffer, and the Observable emits one BlockView per block on the JUCE message thread.
+ 
+ It preallocates `queueCapacity + 2` buffers of `maxBlockSize` values. A buffer can be reused when all BlockViews of it have been destroyed, so don't keep BlockViews around for long (copy the values instead).
+ 
+ @see LockFreeSource, BlockView
+ */
+template<typename T>
+class LockFreeBlockSource : private detail::LockFreeBlockSourceBase<T>, public Observable<BlockView<T>>
+{
+public:
+    /**
+     Creates a new instance.
+     
+     The `maxBlockSize` and `queueCapacity` must be > 0. @see LockFreeSource::LockFreeSource
+     */
+    LockFreeBlockSource(size_t maxBlockSize, size_t queueCapacity, ProducerPolicy producerPolicy = ProducerPolicy::MultipleProducers)
+    : detail::LockFreeBlockSourceBase<T>(maxBlockSize, queueCapacity, producerPolicy),
+      Observable<BlockView<T>>(detail::LockFreeBlockSourceBase<T>::source)
+    {
+        // The block size must be > 0.
+        jassert(maxBlockSize > 0);
+    }
+
+    /**
+     Adds a block of values that will be emitted from the Observable as a BlockView. Blocks larger than `maxBlockSize` are split.
+     
+     The congestionPolicy determines what to do if the queue is full, or if no preallocated buffer is free. Without a free buffer, only CongestionPolicy::Allocate emits the block (allocating a new buffer), the other policies drop it. @see CongestionPolicy
+     */
+    void onNextBatch(const T* values, size_t numValues, CongestionPolicy congestionPolicy)
+    {
+        const auto maxBlockSize = detail::LockFreeBlockSourceBase<T>::pool.getMaxBlockSize();
+
+        while (numValues > 0) {
+            const auto blockSize = juce::jmin(numValues, maxBlockSize);
+            auto block = detail::LockFreeBlockSourceBase<T>::pool.write(values, blockSize, congestionPolicy == CongestionPolicy::Allocate);
+            if (!block.isEmpty())
+                detail::LockFreeBlockSourceBase<T>::source.onNext(std::move(block), congestionPolicy);
+            else if (detail::LockFreeBlockSourceBase<T>::source.statisticsRecorder.isEnabled())
+                detail::LockFreeBlockSourceBase<T>::source.statisticsRecorder.valuesDropped(1);
+
+            values += blockSize;
+            numValues -= blockSize;
+        }
+    }
+
+    /// Limits how much work is done in each message thread callback. @see LockFreeSource::setDrainBudget
+    void setDrainBudget(int maxBlocksPerCallback, const juce::RelativeTime& maxDurationPerCallback = juce::RelativeTime())
+    {
+        detail::LockFreeBlockSourceBase<T>::source.setDrainBudget(maxBlocksPerCallback, maxDurationPerCallback);
+    }
+
+    /// Starts or stops collecting statistics about the blocks. Blocks that are dropped because no preallocated buffer is free count as dropped, too. @see LockFreeSource::setStatisticsEnabled
+    void setStatisticsEnabled(bool shouldBeEnabled, const juce::RelativeTime& snapshotInterval = juce::RelativeTime::seconds(1))
+    {
+        detail::LockFreeBlockSourceBase<T>::source.setStatisticsEnabled(shouldBeEnabled, snapshotInterval);
+    }
+
+    /// @see LockFreeSource::getStatistics
+    LockFreeSourceStatistics getStatistics() const
+    {
+        return detail::LockFreeBlockSourceBase<T>::source.getStatistics();
+    }
+
+    /// @see LockFreeSource::resetStatistics
+    void resetStatistics()
+    {
+        detail::LockFreeBlockSourceBase<T>::source.resetStatistics();
+    }
+
+    /// @see LockFreeSource::statistics
+    Observable<LockFreeSourceStatistics> statistics() const
+    {
+        return detail::LockFreeBlockSourceBase<T>::source.statistics();
+    }
+
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LockFreeBlockSource)
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+/**
+ A snapshot of the statistics of a LockFreeSource (or LockFreeBlockSource), since statistics were enabled or reset.
+ 
+ @see LockFreeSource::setStatisticsEnabled
+ */
+struct LockFreeSourceStatistics
+{
+    /// The number of buckets in the latency histogram.
+    static const int NumLatencyBuckets = 24;
+
+    /// The number of values that onNext has put into the queue.
+    juce::int64 numEnqueued = 0;
+
+    /// The number of values that have been discarded, because the queue was full (with CongestionPolicy::DropNewest or DropOldest).
+    juce::int64 numDropped = 0;
+
+    /// The number of values that have been emitted on the message thread.
+    juce::int64 numEmitted = 0;
+
+    /// The largest number of values that have been in the queue at the same time.
+    size_t highWaterMark = 0;
+
+    /**
+     How long the emitted values have waited in the queue, from onNext until they were emitted on the message thread.
+     
+     Bucket `i` counts the values that waited at least getLatencyBucketStart(i), and less than getLatencyBucketStart(i + 1). The bucket boundaries are powers of two microseconds: Bucket 0 counts latencies below 2µs, bucket 1 counts 2-4µs, bucket 10 counts 1.024-2.048ms, and the last bucket counts everything from about 8.4s.
+     */
+    std::array<juce::int64, NumLatencyBuckets> latencyHistogram{ {} };
+
+    /// Returns the smallest latency that is counted in the given histogram bucket.
+    static juce::RelativeTime getLatencyBucketStart(int bucket)
+    {
+        return juce::RelativeTime((bucket > 0 ? static_cast<double>(juce::int64(1) << bucket) : 0.0) / 1e6);
+    }
+};
@@ -13,9 +13,74 @@ protected:
             .disposedBy(disposeBag);
     }
 
+    LockFreeTargetBase(size_t queueCapacity, CongestionPolicy congestionPolicy, const T& dummy)
+    : queue(0),
+      ringBuffer(new SingleProducerQueue<T>(queueCapacity, dummy))
+    {
+        // The queue capacity must be > 0.
+        jassert(queueCapacity > 0);
+
+        subject.subscribe([this, congestionPolicy](const T& newValue) {
+                   enqueueBounded(newValue, congestionPolicy);
+               })
+            .disposedBy(disposeBag);
+    }
+
+    // Without a ring buffer, this holds all values. With a ring buffer, it only holds the values that didn't fit into the ring buffer (with CongestionPolicy::Allocate), and doesn't preallocate any blocks.
     moodycamel::ConcurrentQueue<T> queue;
+    const std::unique_ptr<SingleProducerQueue<T>> ringBuffer;
+    std::atomic<size_t> numOverflowValues{ 0 };
     PublishSubject<T> subject;
     DisposeBag disposeBag;
+
+    template<typename U>
+    bool dequeue(U& value)
+    {
+        if (!ringBuffer)
+            return queue.try_dequeue(value);
+
+        // Values in the ring buffer are always older than the values in the overflow queue
+        if (ringBuffer->tryDequeue(value))
+            return true;
+
+        if (numOverflowValues.load(std::memory_order_acquire) == 0 || !queue.try_dequeue(value))
+            return false;
+
+        --numOverflowValues;
+        return true;
+    }
+
+private:
+    void enqueueBounded(const T& newValue, CongestionPolicy congestionPolicy)
+    {
+        // To keep the order of values, the ring buffer counts as full while there are values in the overflow queue
+        const bool hasOverflowValues = (numOverflowValues.load(std::memory_order_acquire) > 0);
+
+        switch (congestionPolicy) {
+            // If the ring buffer is full, put the value into the overflow queue, allowing it to allocate memory.
+            case CongestionPolicy::Allocate:
+                if (!hasOverflowValues && ringBuffer->tryEnqueue(newValue))
+                    return;
+
+                // Increment before enqueueing, so the counter is never lower than the number of values in the overflow queue
+                ++numOverflowValues;
+                queue.enqueue(newValue);
+                return;
+
+            case CongestionPolicy::DropNewest:
+                if (!hasOverflowValues)
+                    ringBuffer->tryEnqueue(newValue);
+
+                return;
+
+            // The oldest values may be in the overflow queue. In this case, drop the new value instead.
+            case CongestionPolicy::DropOldest:
+                if (!hasOverflowValues)
+                    ringBuffer->enqueueDroppingOldest(newValue);
+
+                return;
+        }
+    }
 };
 }
 
@@ -23,15 +88,30 @@ protected:
  An `Observer` that puts all retrieved values in a lock-free queue. The queue can be accessed from another thread without locking.
  
  Useful to transfer data from a non-realtime thread to a realtime thread.
+ 
+ Pass a capacity to the constructor to get a preallocated queue with bounded memory. Otherwise, the queue grows as needed, e.g. if the realtime thread stops dequeueing values because the audio device has been stopped.
  */
 template<typename T>
 class LockFreeTarget : private detail::LockFreeTargetBase<T>, public Observer<T>
 {
 public:
+    /// Creates a new instance with an unbounded queue. Retrieving a value may allocate memory if the queue is full.
     LockFreeTarget()
     : Observer<T>(detail::LockFreeTargetBase<T>::subject)
     {}
 
+    /**
+     Creates a new instance with a preallocated queue, which holds up to `queueCapacity` values.
+     
+     The congestionPolicy determines what to do if a value is retrieved while the queue is full. Unless it's CongestionPolicy::Allocate, memory is never allocated after construction, neither when retrieving nor when dequeueing values (unless assigning a T does). @see CongestionPolicy
+     
+     The queueCapacity must be > 0. It's rounded up to the next power of two. With a bounded queue, values may be retrieved on one thread at a time, and dequeued on one (other) thread at a time.
+     */
+    LockFreeTarget(size_t queueCapacity, CongestionPolicy congestionPolicy, const T& dummy = T())
+    : detail::LockFreeTargetBase<T>(queueCapacity, congestionPolicy, dummy),
+      Observer<T>(detail::LockFreeTargetBase<T>::subject)
+    {}
+
     /**
      Dequeues the next value from the queue (if it's non-empty) and assigns it to `value`.
      
@@ -39,12 +119,16 @@ public:
      
      Does not lock. Uses move-assignment if `value` supports it, copy-assignment otherwise. Does not allocate dynamic memory, unless `value` does during assigment.
      
-     May be called from any thread, including the thread on which the `Observer` retrieves values.
+     May be called from any thread, including the thread on which the `Observer` retrieves values. With a bounded queue, it must only be called from one thread at a time.
      */
     template<typename U>
     bool tryDequeue(U& value)
     {
-        return detail::LockFreeTargetBase<T>::queue.try_dequeue(value);
+        // Assigning the value may allocate memory or lock
+        if (!std::is_trivially_copyable<U>::value)
+            REAX_CHECK_REALTIME_SAFE("Dequeueing a value that isn't trivially copyable in LockFreeTarget::tryDequeue");
+
+        return detail::LockFreeTargetBase<T>::dequeue(value);
     }
 
     /**
@@ -54,7 +138,7 @@ public:
      
      Does not lock. Uses move-assignment if `value` supports it, copy-assignment otherwise. Does not allocate dynamic memory, unless `value` does during assigment.
      
-     May be called from any thread, including the thread on which the `Observer` retrieves values.
+     May be called from any thread, including the thread on which the `Observer` retrieves values. With a bounded queue, it must only be called from one thread at a time.
      */
     template<typename U>
     bool tryDequeueAll(U& value)
@@ -69,3 +153,283 @@ public:
 private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LockFreeTarget)
 };
+
+namespace detail {
+template<typename T>
+class LatestValueTargetBase
+{
+protected:
+    explicit LatestValueTargetBase(const T& initialValue)
+    : slots{ { {}, initialValue, {} }, { {}, initialValue, {} }, { {}, initialValue, {} } }
+    {
+        frontIndex.value = 0;
+        middleIndex.value = 1;
+        backIndex.value = 2;
+
+        subject.subscribe([this](const T& newValue) {
+                   write(newValue);
+               })
+            .disposedBy(disposeBag);
+    }
+
+    // A triple buffer: The writer writes into the back slot, the reader reads from the front slot. The middle slot holds the latest complete value. Both sides swap their slot with the middle slot, so they never access the same slot at the same time.
+    static const juce::uint8 IndexMask = 3;
+    static const juce::uint8 NewValueFlag = 4;
+
+    CacheLinePadded<T> slots[3];
+    CacheLinePadded<std::atomic<juce::uint8>> middleIndex;
+    CacheLinePadded<juce::uint8> frontIndex;
+    CacheLinePadded<juce::uint8> backIndex;
+
+    // Only called by the writer
+    void write(const T& newValue)
+    {
+        slots[backIndex.value].value = newValue;
+
+        // Publish the written slot, and continue writing into the previous middle slot
+        backIndex.value = middleIndex.value.exchange(backIndex.value | NewValueFlag, std::memory_order_acq_rel) & IndexMask;
+    }
+
+    // Only called by the reader. Returns true if there was a new value.
+    bool update()
+    {
+        if ((middleIndex.value.load(std::memory_order_relaxed) & NewValueFlag) == 0)
+            return false;
+
+        // Take the latest value, and give the previous front slot to the writer
+        frontIndex.value = middleIndex.value.exchange(frontIndex.value, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+
+    PublishSubject<T> subject;
+    DisposeBag disposeBag;
+};
+}
+
+/**
+ An `Observer` that keeps only the latest retrieved value. The value can be read from another thread without locking.
+ 
+ Use this instead of LockFreeTarget for parameter-like data, where only the latest value matters: Reading is wait-free and takes constant time, no matter how many values have been retrieved since the last read. It never allocates memory, unless assigning a T does.
+ 
+ Values may be retrieved on one thread at a time, and read on one (other) thread at a time, e.g. the audio thread.
+ */
+template<typename T>
+class LatestValueTarget : private detail::LatestValueTargetBase<T>, public Observer<T>
+{
+public:
+    /// Creates a new instance. Until a value is retrieved, getLatestValue() returns the `initialValue`.
+    explicit LatestValueTarget(const T& initialValue = T())
+    : detail::LatestValueTargetBase<T>(initialValue),
+      Observer<T>(detail::LatestValueTargetBase<T>::subject)
+    {}
+
+    /**
+     If a new value has been retrieved since the last read, assigns it to `value` and returns `true`. Otherwise returns `false` and leaves `value` untouched.
+     
+     Does not lock and does not allocate dynamic memory, unless `value` does during assignment.
+     */
+    template<typename U>
+    bool tryGetNewValue(U& value)
+    {
+        if (!detail::LatestValueTargetBase<T>::update())
+            return false;
+
+        value = getCurrentValue();
+        return true;
+    }
+
+    /**
+     Returns the latest retrieved value.
+     
+     The returned reference stays valid until the next call to getLatestValue() or tryGetNewValue(). Does not lock and does not allocate dynamic memory.
+     */
+    const T& getLatestValue()
+    {
+        detail::LatestValueTargetBase<T>::update();
+        return getCurrentValue();
+    }
+
+private:
+    const T& getCurrentValue() const
+    {
+        return detail::LatestValueTargetBase<T>::slots[detail::LatestValueTargetBase<T>::frontIndex.value].value;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LatestValueTarget)
+};
+
+/**
+ Determines how a SmoothedValueTarget ramps from its current value to a new target value.
+ 
+ Linear: The value changes by the same amount in each sample.
+ 
+ Multiplicative: The value is multiplied by the same factor in each sample, which sounds linear for gains and frequencies. All values must be > 0.
+ */
+enum class SmoothingType {
+    Linear,
+    Multiplicative
+};
+
+/**
+ An `Observer` for parameter values that are used on the audio thread, which ramps smoothly to each retrieved value to avoid zipper noise.
+ 
+ Subscribe it to an Observable (e.g. a Slider value) on the message thread, and call fillRamp() or getNextValue() on the audio thread. The latest retrieved value is passed to the audio thread through a LatestValueTarget-like triple buffer, so nothing locks or allocates.
+ 
+ Call reset() in `prepareToPlay` to set the sample rate and ramp length. Until then, new values are applied without ramping.
+ 
+ The value type must be `float` or `double`. Values may be retrieved on one thread at a time, and the ramp must only be read on one (other) thread at a time.
+ */
+template<typename T>
+class SmoothedValueTarget : private detail::LatestValueTargetBase<T>, public Observer<T>
+{
+    static_assert(std::is_floating_point<T>::value, "SmoothedValueTarget only supports float and double.");
+
+    typedef detail::LatestValueTargetBase<T> Base;
+
+public:
+    /// Creates a new instance. The ramp starts at the `initialValue`.
+    explicit SmoothedValueTarget(const T& initialValue = T(), SmoothingType smoothingType = SmoothingType::Linear)
+    : Base(initialValue),
+      Observer<T>(Base::subject),
+      smoothingType(smoothingType),
+      currentValue(initialValue),
+      targetValue(initialValue)
+    {
+        // Multiplicative smoothing only works with values > 0.
+        jassert(smoothingType == SmoothingType::Linear || initialValue > 0);
+    }
+
+    /**
+     Sets the length of a ramp, and jumps to the latest retrieved value without ramping.
+     
+     Call this on the audio thread, e.g. in `prepareToPlay`. A `rampLengthInSeconds` of 0 disables smoothing.
+     */
+    void reset(double sampleRate, double rampLengthInSeconds)
+    {
+        // The sample rate and ramp length must be >= 0.
+        jassert(sampleRate >= 0 && rampLengthInSeconds >= 0);
+
+        numRampSamples = juce::roundToInt(sampleRate * rampLengthInSeconds);
+        Base::update();
+        currentValue = targetValue = Base::slots[Base::frontIndex.value].value;
+        numRemainingSamples = 0;
+    }
+
+    /**
+     Returns the next value of the ramp, and advances the ramp by one sample.
+     
+     If you need the values for a whole block, use fillRamp() instead: It's faster, because it checks for a new target value only once per block.
+     */
+    T getNextValue()
+    {
+        pullTargetValue();
+
+        if (numRemainingSamples == 0)
+            return targetValue;
+
+        advance();
+        return currentValue;
+    }
+
+    /**
+     Writes the next `numSamples` values of the ramp to `destination`, and advances the ramp accordingly.
+     
+     Does not lock, does not allocate memory, and doesn't branch per sample.
+     */
+    void fillRamp(T* destination, int numSamples)
+    {
+        pullTargetValue();
+
+        const int numValuesOnRamp = juce::jmin(numSamples, numRemainingSamples);
+
+        if (numValuesOnRamp > 0) {
+            if (smoothingType == SmoothingType::Linear) {
+                // Computes each value independently, so the compiler can vectorize the loop
+                const T startValue = currentValue;
+                for (int i = 0; i < numValuesOnRamp; ++i)
+                    destination[i] = startValue + step * static_cast<T>(i + 1);
+            }
+            else {
+                T value = currentValue;
+                for (int i = 0; i < numValuesOnRamp; ++i) {
+                    value *= step;
+                    destination[i] = value;
+                }
+            }
+
+            numRemainingSamples -= numValuesOnRamp;
+            currentValue = (numRemainingSamples == 0 ? targetValue : destination[numValuesOnRamp - 1]);
+            destination[numValuesOnRamp - 1] = currentValue;
+        }
+
+        if (numSamples > numValuesOnRamp)
+            juce::FloatVectorOperations::fill(destination + numValuesOnRamp, targetValue, numSamples - numValuesOnRamp);
+    }
+
+    /// Returns the current value of the ramp, without advancing it. Only call this on the audio thread.
+    T getCurrentValue() const
+    {
+        return currentValue;
+    }
+
+    /// Returns the value that the ramp is moving towards. Only call this on the audio thread.
+    T getTargetValue() const
+    {
+        return targetValue;
+    }
+
+    /// Returns true if the ramp hasn't reached its target value yet. Only call this on the audio thread.
+    bool isSmoothing() const
+    {
+        return (numRemainingSamples > 0);
+    }
+
+private:
+    // Only used on the audio thread
+    const SmoothingType smoothingType;
+    int numRampSamples = 0;
+    int numRemainingSamples = 0;
+    T currentValue;
+    T targetValue;
+    T step = 0;
+
+    // Starts a new ramp if a new target value has been retrieved
+    void pullTargetValue()
+    {
+        if (!Base::update())
+            return;
+
+        targetValue = Base::slots[Base::frontIndex.value].value;
+
+        if (numRampSamples == 0) {
+            currentValue = targetValue;
+            numRemainingSamples = 0;
+            return;
+        }
+
+        numRemainingSamples = numRampSamples;
+
+        if (smoothingType == SmoothingType::Linear) {
+            step = (targetValue - currentValue) / static_cast<T>(numRampSamples);
+        }
+        else {
+            // Multiplicative smoothing only works with values > 0.
+            jassert(targetValue > 0);
+            step = std::exp((std::log(targetValue) - std::log(currentValue)) / static_cast<T>(numRampSamples));
+        }
+    }
+
+    void advance()
+    {
+        --numRemainingSamples;
+
+        if (numRemainingSamples == 0)
+            currentValue = targetValue;
+        else if (smoothingType == SmoothingType::Linear)
+            currentValue += step;
+        else
+            currentValue *= step;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SmoothedValueTarget)
+};
@@ -0,0 +1,44 @@
+namespace {
+// The number of ScopedRealtimeThread instances on the current thread
+thread_local int numRealtimeScopes = 0;
+
+void logRealtimeViolation(const char* operation)
+{
+    Logger::writeToLog("ReaX: " + String(operation) + " on a realtime thread.");
+
+    // ReaX did something that isn't realtime-safe on a realtime thread. See the log for what happened.
+    jassertfalse;
+}
+
+std::atomic<ScopedRealtimeThread::ViolationHandler> violationHandler{ &logRealtimeViolation };
+}
+
+bool detail::isRealtimeThread() noexcept
+{
+    return (numRealtimeScopes > 0);
+}
+
+void detail::reportRealtimeViolation(const char* operation)
+{
+    violationHandler.load(std::memory_order_acquire)(operation);
+}
+
+ScopedRealtimeThread::ScopedRealtimeThread() noexcept
+{
+    ++numRealtimeScopes;
+}
+
+ScopedRealtimeThread::~ScopedRealtimeThread()
+{
+    --numRealtimeScopes;
+}
+
+bool ScopedRealtimeThread::isRealtimeThread() noexcept
+{
+    return detail::isRealtimeThread();
+}
+
+void ScopedRealtimeThread::setViolationHandler(ViolationHandler handler)
+{
+    violationHandler.store((handler != nullptr ? handler : &logRealtimeViolation), std::memory_order_release);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+/**
+ Marks the current thread as a realtime thread (e.g. the audio thread) while the instance exists.
+ 
+ If the module is compiled with `REAX_ENABLE_REALTIME_CHECKS`, ReaX reports when it does something on a realtime thread that isn't realtime-safe: Allocating memory (e.g. LockFreeSource::onNext with CongestionPolicy::Allocate when the queue is full), locking a mutex (e.g. subscribing to a Subject), boxing a value that doesn't fit into the inline storage of an Observable value, or calling Observer::onNext.
+ 
+ Create one at the start of your audio callback:
+ 
+     void processBlock(AudioBuffer<float>& buffer, MidiBuffer& midi) override
+     {
+         const ScopedRealtimeThread realtimeThread;
+         ...
+     }
+ 
+ Instances can be nested. Creating and destroying an instance is wait-free.
+ */
+class ScopedRealtimeThread
+{
+public:
+    /// A function that is called when ReaX does something that isn't realtime-safe on a realtime thread. It's called on that thread, with a description of the operation.
+    typedef void (*ViolationHandler)(const char* operation);
+
+    /// Marks the current thread as a realtime thread.
+    ScopedRealtimeThread() noexcept;
+
+    /// Removes the mark, unless another instance exists on this thread.
+    ~ScopedRealtimeThread();
+
+    /// Returns true if a ScopedRealtimeThread exists on the current thread.
+    static bool isRealtimeThread() noexcept;
+
+    /// Sets the function that's called for each violation. Pass nullptr to restore the default handler, which logs the operation and triggers an assertion.
+    static void setViolationHandler(ViolationHandler handler);
+
+private:
+    JUCE_DECLARE_NON_COPYABLE(ScopedRealtimeThread)
+};
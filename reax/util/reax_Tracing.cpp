@@ -0,0 +1,237 @@
+#if REAX_ENABLE_TRACING
+namespace {
+// The events of one thread. Only that thread writes to it, any thread may read from it.
+//
+// The writer increments numStarted before it overwrites an event, and numWritten afterwards. A reader copies the events up to numWritten, and then discards the copies of events that may have been overwritten in the meantime (according to numStarted).
+struct ThreadTraceBuffer
+{
+    struct Event
+    {
+        std::atomic<const char*> name;
+        std::atomic<int64> ticks;
+        std::atomic<int64> count;
+        std::atomic<char> phase;
+    };
+
+    std::atomic<Thread::ThreadID> threadID;
+    std::atomic<bool> isClaimed;
+    std::atomic<uint64> numStarted;
+    std::atomic<uint64> numWritten;
+
+    // Events before this index have been discarded by Tracing::clear, or were recorded by a thread that has exited
+    std::atomic<uint64> firstIndex;
+
+    Event events[REAX_TRACE_BUFFER_SIZE];
+};
+
+const int MaxTraceThreads = REAX_TRACE_MAX_THREADS;
+
+// Zero-initialized static storage, so that no memory is allocated when a thread records its first event
+ThreadTraceBuffer traceBuffers[MaxTraceThreads];
+
+// The buffers before this index may contain events
+std::atomic<int> numUsedTraceBuffers{ 0 };
+
+// Claims a free buffer for the calling thread, or returns nullptr if all buffers are taken
+ThreadTraceBuffer* claimThreadTraceBuffer() noexcept
+{
+    for (int i = 0; i < MaxTraceThreads; ++i) {
+        auto& buffer = traceBuffers[i];
+        bool isClaimed = false;
+        if (!buffer.isClaimed.compare_exchange_strong(isClaimed, true, std::memory_order_acq_rel))
+            continue;
+
+        // Discard the events of the thread that had this buffer before
+        buffer.firstIndex.store(buffer.numWritten.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        buffer.threadID.store(Thread::getCurrentThreadId(), std::memory_order_relaxed);
+
+        int numUsed = numUsedTraceBuffers.load(std::memory_order_relaxed);
+        while (numUsed <= i && !numUsedTraceBuffers.compare_exchange_weak(numUsed, i + 1))
+            ;
+
+        return &buffer;
+    }
+
+    return nullptr;
+}
+
+// Holds the buffer of the current thread, and releases it when the thread exits, so that threads which are created later can use it.
+// The events stay in the buffer (and are exported) until another thread claims it.
+class ThreadTraceBufferHolder
+{
+public:
+    ~ThreadTraceBufferHolder()
+    {
+        if (buffer != nullptr)
+            buffer->isClaimed.store(false, std::memory_order_release);
+    }
+
+    ThreadTraceBuffer* getBuffer() noexcept
+    {
+        if (!hasClaimed) {
+            buffer = claimThreadTraceBuffer();
+            hasClaimed = true;
+        }
+
+        return buffer;
+    }
+
+private:
+    ThreadTraceBuffer* buffer = nullptr;
+    bool hasClaimed = false;
+};
+
+// Registering the destructor of a thread_local may allocate memory once per thread (when the thread records its first event)
+thread_local ThreadTraceBufferHolder threadTraceBuffer;
+
+struct TraceNames
+{
+    std::mutex mutex;
+    std::set<std::string> names;
+};
+
+TraceNames& getTraceNames()
+{
+    static TraceNames traceNames;
+    return traceNames;
+}
+
+const uint64 TraceBufferSize = REAX_TRACE_BUFFER_SIZE;
+
+// Copies the valid events of a buffer into an array of Chrome trace events
+void addChromeTraceEvents(const ThreadTraceBuffer& buffer, int threadIndex, Array<var>& traceEvents)
+{
+    struct EventCopy
+    {
+        const char* name;
+        int64 ticks;
+        int64 count;
+        char phase;
+    };
+
+    const uint64 end = buffer.numWritten.load(std::memory_order_acquire);
+    if (end == 0)
+        return;
+
+    const uint64 begin = jmax(buffer.firstIndex.load(std::memory_order_relaxed), (end > TraceBufferSize ? end - TraceBufferSize : 0));
+
+    std::vector<EventCopy> copies;
+    copies.reserve(static_cast<size_t>(end - begin));
+    for (uint64 i = begin; i < end; ++i) {
+        const auto& event = buffer.events[i % TraceBufferSize];
+        copies.push_back({ event.name.load(std::memory_order_relaxed), event.ticks.load(std::memory_order_relaxed), event.count.load(std::memory_order_relaxed), event.phase.load(std::memory_order_relaxed) });
+    }
+
+    // Discard the events that the thread may have overwritten while they were copied
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64 numStarted = buffer.numStarted.load(std::memory_order_relaxed);
+    const uint64 firstValidIndex = (numStarted > TraceBufferSize ? numStarted - TraceBufferSize : 0);
+    const size_t numInvalid = static_cast<size_t>(jmin(end, jmax(begin, firstValidIndex)) - begin);
+
+    const auto threadID = buffer.threadID.load(std::memory_order_relaxed);
+    const auto messageManager = MessageManager::getInstanceWithoutCreating();
+    const bool isMessageThread = (messageManager != nullptr && messageManager->getCurrentMessageThread() == threadID);
+
+    DynamicObject::Ptr threadName = new DynamicObject();
+    threadName->setProperty("name", (isMessageThread ? "Message Thread" : "Thread " + String(threadIndex + 1)));
+
+    DynamicObject::Ptr metadata = new DynamicObject();
+    metadata->setProperty("name", "thread_name");
+    metadata->setProperty("ph", "M");
+    metadata->setProperty("pid", 1);
+    metadata->setProperty("tid", threadIndex + 1);
+    metadata->setProperty("args", threadName.get());
+    traceEvents.add(metadata.get());
+
+    for (size_t i = numInvalid; i < copies.size(); ++i) {
+        const auto& copy = copies[i];
+
+        DynamicObject::Ptr event = new DynamicObject();
+        event->setProperty("name", copy.name);
+        event->setProperty("cat", "reax");
+        event->setProperty("ph", String::charToString(static_cast<juce_wchar>(copy.phase)));
+        event->setProperty("ts", Time::highResolutionTicksToSeconds(copy.ticks) * 1e6);
+        event->setProperty("pid", 1);
+        event->setProperty("tid", threadIndex + 1);
+
+        // Instant events are shown for their thread only
+        if (copy.phase == static_cast<char>(detail::TracePhase::Instant))
+            event->setProperty("s", "t");
+
+        if (copy.count >= 0) {
+            DynamicObject::Ptr args = new DynamicObject();
+            args->setProperty("count", copy.count);
+            event->setProperty("args", args.get());
+        }
+
+        traceEvents.add(event.get());
+    }
+}
+}
+
+void detail::addTraceEvent(const char* name, TracePhase phase, juce::int64 count) noexcept
+{
+    const auto buffer = threadTraceBuffer.getBuffer();
+    if (buffer == nullptr)
+        return;
+
+    const uint64 index = buffer->numStarted.load(std::memory_order_relaxed);
+    buffer->numStarted.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto& event = buffer->events[index % TraceBufferSize];
+    event.name.store(name, std::memory_order_relaxed);
+    event.ticks.store(Time::getHighResolutionTicks(), std::memory_order_relaxed);
+    event.count.store(count, std::memory_order_relaxed);
+    event.phase.store(static_cast<char>(phase), std::memory_order_relaxed);
+
+    buffer->numWritten.store(index + 1, std::memory_order_release);
+}
+
+const char* detail::internTraceName(const juce::String& name)
+{
+    REAX_CHECK_REALTIME_SAFE("Creating a traced Observable operator");
+
+    auto& traceNames = getTraceNames();
+    std::lock_guard<std::mutex> lock(traceNames.mutex);
+
+    // The strings in a std::set never move
+    return traceNames.names.insert(name.toStdString()).first->c_str();
+}
+#endif
+
+bool Tracing::isEnabled()
+{
+    return bool(REAX_ENABLE_TRACING);
+}
+
+juce::String Tracing::getChromeTraceJSON()
+{
+    Array<var> traceEvents;
+
+#if REAX_ENABLE_TRACING
+    const int numThreads = numUsedTraceBuffers.load();
+    for (int i = 0; i < numThreads; ++i)
+        addChromeTraceEvents(traceBuffers[i], i, traceEvents);
+#endif
+
+    DynamicObject::Ptr trace = new DynamicObject();
+    trace->setProperty("traceEvents", traceEvents);
+    trace->setProperty("displayTimeUnit", "ms");
+
+    return JSON::toString(trace.get());
+}
+
+bool Tracing::writeChromeTrace(const juce::File& file)
+{
+    return file.replaceWithText(getChromeTraceJSON());
+}
+
+void Tracing::clear()
+{
+#if REAX_ENABLE_TRACING
+    const int numThreads = numUsedTraceBuffers.load();
+    for (int i = 0; i < numThreads; ++i)
+        traceBuffers[i].firstIndex.store(traceBuffers[i].numWritten.load(std::memory_order_acquire), std::memory_order_relaxed);
+#endif
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+/**
+ Exports the trace events that ReaX records if `REAX_ENABLE_TRACING` is set to 1. Use this to find out where the time goes between the audio thread and the GUI.
+ 
+ The following events are recorded:
+ 
+ - The time spent in the functions passed to Observable operators, named like the operators in Instrumentation (e.g. "meterChain/map").
+ - Each value that is enqueued into (or dropped by) a LockFreeSource, and each batch of values that it emits on the message thread.
+ - Each action that Scheduler::messageThread or Scheduler::threadPool dispatches.
+ 
+ Each thread records into its own preallocated ring buffer, without locking or allocating memory. Only the latest `REAX_TRACE_BUFFER_SIZE` events of each thread are kept. Up to `REAX_TRACE_MAX_THREADS` threads can record events at the same time, additional threads are ignored. When a thread exits, its buffer is reused by the next thread that records an event.
+ */
+class Tracing
+{
+public:
+    /// Returns true if the module is compiled with `REAX_ENABLE_TRACING`.
+    static bool isEnabled();
+
+    /// Returns the recorded events in the Chrome trace event format. If tracing is disabled, the returned trace is empty. Can be called from any thread.
+    static juce::String getChromeTraceJSON();
+
+    /// Writes the recorded events to a file in the Chrome trace event format, which can be opened in Perfetto (https://ui.perfetto.dev) or chrome://tracing. Returns true if the file was written.
+    static bool writeChromeTrace(const juce::File& file);
+
+    /// Discards the events that have been recorded so far, e.g. to trace a specific time span.
+    static void clear();
+
+private:
+    Tracing() = delete;
+};